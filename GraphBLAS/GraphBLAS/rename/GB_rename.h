@@ -284,6 +284,7 @@
 #define GB_Descriptor_get GM_Descriptor_get
 #define GB_deserialize_from_blob GM_deserialize_from_blob
 #define GB_deserialize GM_deserialize
+#define GB_deserialize_stream GM_deserialize_stream
 #define GB_dup GM_dup
 #define GB_dup_worker GM_dup_worker
 #define GB_ek_slice GM_ek_slice
@@ -512,6 +513,7 @@
 #define GB_ijsort GM_ijsort
 #define GB_import GM_import
 #define GB_IndexUnaryOp_check GM_IndexUnaryOp_check
+#define GB_ingest GM_ingest
 #define GB_init GM_init
 #define GB_is_diagonal GM_is_diagonal
 #define GB_is_shallow GM_is_shallow
@@ -924,6 +926,7 @@
 #define GB_msort_3_create_merge_tasks GM_msort_3_create_merge_tasks
 #define GB_msort_3 GM_msort_3
 #define GB_mxm GM_mxm
+#define GB_mxv_batch GM_mxv_batch
 #define GB_new_bix GM_new_bix
 #define GB_new GM_new
 #define GB_nnz_full GM_nnz_full
@@ -1014,6 +1017,7 @@
 #define GB_serialize_free_blocks GM_serialize_free_blocks
 #define GB_serialize GM_serialize
 #define GB_serialize_method GM_serialize_method
+#define GB_serialize_stream GM_serialize_stream
 #define GB_serialize_to_blob GM_serialize_to_blob
 #define GB_setElement GM_setElement
 #define GB_shallow_copy GM_shallow_copy
@@ -1094,6 +1098,7 @@
 #define GB_unop_iso GM_unop_iso
 #define GB_unop_new GM_unop_new
 #define GB_unop_one GM_unop_one
+#define GB_unshallow GM_unshallow
 #define GB_user_op_jit GM_user_op_jit
 #define GB_user_type_jit GM_user_type_jit
 #define GB_Vector_check GM_Vector_check
@@ -3417,6 +3422,8 @@
 #define GxB_Matrix_build_Scalar GxM_Matrix_build_Scalar
 #define GxB_Matrix_concat GxM_Matrix_concat
 #define GxB_Matrix_deserialize GxM_Matrix_deserialize
+#define GxB_Matrix_deserialize_shallow GxM_Matrix_deserialize_shallow
+#define GxB_Matrix_deserialize_stream GxM_Matrix_deserialize_stream
 #define GxB_Matrix_diag GxM_Matrix_diag
 #define GxB_Matrix_eWiseUnion GxM_Matrix_eWiseUnion
 #define GxB_Matrix_export_BitmapC GxM_Matrix_export_BitmapC
@@ -3444,6 +3451,7 @@
 #define GxB_Matrix_import_FullR GxM_Matrix_import_FullR
 #define GxB_Matrix_import_HyperCSC GxM_Matrix_import_HyperCSC
 #define GxB_Matrix_import_HyperCSR GxM_Matrix_import_HyperCSR
+#define GxB_Matrix_ingest GxM_Matrix_ingest
 #define GxB_Matrix_iso GxM_Matrix_iso
 #define GxB_Matrix_isStoredElement GxM_Matrix_isStoredElement
 #define GxB_Matrix_memoryUsage GxM_Matrix_memoryUsage
@@ -3470,6 +3478,7 @@
 #define GxB_Matrix_select_FC64 GxM_Matrix_select_FC64
 #define GxB_Matrix_select GxM_Matrix_select
 #define GxB_Matrix_serialize GxM_Matrix_serialize
+#define GxB_Matrix_serialize_stream GxM_Matrix_serialize_stream
 #define GxB_Matrix_setElement_FC32 GxM_Matrix_setElement_FC32
 #define GxB_Matrix_setElement_FC64 GxM_Matrix_setElement_FC64
 #define GxB_Matrix_sort GxM_Matrix_sort
@@ -3976,6 +3985,7 @@
 #define GxB_Monoid_terminal_new_UINT32 GxM_Monoid_terminal_new_UINT32
 #define GxB_Monoid_terminal_new_UINT64 GxM_Monoid_terminal_new_UINT64
 #define GxB_Monoid_terminal_new_UINT8 GxM_Monoid_terminal_new_UINT8
+#define GxB_mxv_batch GxM_mxv_batch
 #define GxB_NE_FC32 GxM_NE_FC32
 #define GxB_NE_FC64 GxM_NE_FC64
 #define GxB_NE_THUNK GxM_NE_THUNK
@@ -4735,3 +4745,4 @@
 #define GxB_Vector_unpack_Bitmap GxM_Vector_unpack_Bitmap
 #define GxB_Vector_unpack_CSC GxM_Vector_unpack_CSC
 #define GxB_Vector_unpack_Full GxM_Vector_unpack_Full
+#define GxB_vxm_batch GxM_vxm_batch
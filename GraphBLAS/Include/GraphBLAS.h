@@ -3847,6 +3847,45 @@ GrB_Info GxB_Matrix_split           // split a matrix into 2D array of matrices
     const GrB_Descriptor desc       // unused, except threading control
 ) ;
 
+//------------------------------------------------------------------------------
+// GxB_Matrix_ingest: merge matrices filled by several user threads
+//------------------------------------------------------------------------------
+
+// A single GrB_Matrix may not be modified by more than one user thread at a
+// time, so streaming inserts into one matrix with GrB_Matrix_setElement are
+// limited to a single thread.  Instead, each user thread can own a private
+// "piece": a matrix of the same dimensions as C, which it fills on its own
+// with GrB_Matrix_setElement, GrB_assign, or any other method.  The pending
+// tuples of each piece are private to that thread, so all threads can insert
+// concurrently.  Each thread may also call GrB_wait on its own piece, at any
+// time (typically once its number of pending tuples exceeds a threshold of
+// its choosing), to sort and assemble its tuples off the critical path of the
+// other threads.
+
+// GxB_Matrix_ingest then merges all the pieces into C with a single call:
+//
+//      C = dup (C, Pieces{0}, Pieces{1}, ..., Pieces{npieces-1})
+//
+// where an entry present in just one of these matrices is copied into C, and
+// entries present in more than one are combined with the dup operator, in the
+// order listed (dup must be associative, as it must be for GrB_Matrix_build).
+// If dup is NULL, the SECOND operator is used, so that entries in later
+// pieces take precedence.  Duplicate entries inside a single piece are
+// resolved as usual for that piece, when its own pending work is finished.
+// Any pending work in the pieces is finished in parallel, and the pieces are
+// then merged in parallel, in a tree of depth log2(npieces).  On output, all
+// pieces are cleared (they keep their type and dimensions) so that they can
+// be reused.  No piece may be aliased with C or with another piece.
+
+GrB_Info GxB_Matrix_ingest          // merge an array of matrices into C
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_BinaryOp dup,         // operator for duplicates, or NULL
+    GrB_Matrix *Pieces,             // array of size npieces; cleared on output
+    const GrB_Index npieces,
+    const GrB_Descriptor desc       // unused, except threading control
+) ;
+
 //------------------------------------------------------------------------------
 // GxB_Matrix_diag, GxB_Vector_diag, GrB_Matrix_diag
 //------------------------------------------------------------------------------
@@ -4303,9 +4342,62 @@ typedef enum
 
     // GPU control (DRAFT: in progress, do not use)
     GxB_CONTEXT_GPU_ID      = GxB_GPU_ID,
+
+    // performance trace (see GxB_Trace_Record below)
+    GxB_CONTEXT_TRACE = 7110,       // trace function, or NULL if disabled
+    GxB_CONTEXT_TRACE_COOKIE = 7111,    // user pointer passed to the trace
 }
 GxB_Context_Field ;
 
+//------------------------------------------------------------------------------
+// GxB_Trace_Record: a structured performance trace of a single GraphBLAS call
+//------------------------------------------------------------------------------
+
+// If a trace function is set in the Context engaged by a user thread, with
+// GxB_Context_set_FUNCTION (Context, GxB_CONTEXT_TRACE, trace), then each
+// top-level GraphBLAS operation performed by that thread (the same operations
+// reported by the GxB_BURBLE) constructs a GxB_Trace_Record and passes it to
+// the trace function, just before the operation returns.  The record is owned
+// by GraphBLAS and is valid only during the call to the trace function, which
+// must copy any content it wishes to keep.  The trace function must not call
+// any GraphBLAS method.  The record is built in the workspace of the call, so
+// it is cheap enough to leave on; if no trace function is set (the default),
+// no record is built at all.
+
+typedef enum
+{
+    GxB_TRACE_JIT_NONE = 0,     // no JIT or PreJIT kernel was used
+    GxB_TRACE_JIT_HIT = 1,      // kernel(s) found in the JIT hash table
+    GxB_TRACE_JIT_LOAD = 2,     // a kernel was loaded from the JIT cache
+    GxB_TRACE_JIT_COMPILE = 3,  // a kernel was compiled and loaded
+}
+GxB_Trace_JIT ;
+
+typedef struct
+{
+    const char *operation ; // name of the operation, as shown by the burble
+    const char *method ;    // method chosen (such as "saxpy3" or "dot2"),
+                            // or NULL if the operation has no such choice
+    int32_t C_sparsity ;    // sparsity format of C on output, A and B on
+    int32_t A_sparsity ;    // input (GxB_HYPERSPARSE, GxB_SPARSE, GxB_BITMAP,
+    int32_t B_sparsity ;    // or GxB_FULL); 0 if not applicable
+    int32_t nthreads ;      // # of threads used (or the max # available)
+    int64_t C_nvals ;       // # of entries in C on output, and in A and B
+    int64_t A_nvals ;       // on input; -1 if not applicable or unknown
+    int64_t B_nvals ;
+    double flops ;          // flop count estimate, or -1 if unknown
+    GxB_Trace_JIT jit ;     // JIT status of the kernel(s) used
+    double jit_time ;       // time spent in the JIT (in seconds)
+    double time ;           // wall-clock time of the whole operation
+}
+GxB_Trace_Record ;
+
+typedef void (*GxB_trace_function)
+(
+    const GxB_Trace_Record *record,     // trace record of one operation
+    void *cookie                        // GxB_CONTEXT_TRACE_COOKIE
+) ;
+
 GrB_Info GxB_Context_new            // create a new Context
 (
     GxB_Context *Context            // handle of Context to create
@@ -4330,6 +4422,13 @@ GrB_Info GxB_Context_set_FP64       // set a parameter in a Context
     double value                    // value to change it to
 ) ;
 
+GrB_Info GxB_Context_set_FUNCTION   // set a parameter in a Context
+(
+    GxB_Context Context,            // Context to modify
+    GxB_Context_Field field,        // parameter to change
+    void *value                     // value to change it to
+) ;
+
 GrB_Info GxB_Context_set            // set a parameter in a Context
 (
     GxB_Context Context,            // Context to modify
@@ -4351,6 +4450,13 @@ GrB_Info GxB_Context_get_FP64       // get a parameter in a Context
     double *value                   // return value from the Context
 ) ;
 
+GrB_Info GxB_Context_get_FUNCTION   // get a parameter in a Context
+(
+    GxB_Context Context,            // Context to query
+    GxB_Context_Field field,        // parameter to query
+    void **value                    // return value from the Context
+) ;
+
 GrB_Info GxB_Context_get            // get a parameter in a Context
 (
     GxB_Context Context,            // Context to query
@@ -4440,6 +4546,11 @@ GrB_Info GxB_Context_disengage      // disengage a Context
 //
 //      GxB_set (GxB_Context Context, GxB_CHUNK, double chunk) ;
 //      GxB_get (GxB_Context Context, GxB_CHUNK, double *chunk) ;
+//
+//      GxB_set (GxB_Context Context, GxB_CONTEXT_TRACE, trace_function) ;
+//      GxB_get (GxB_Context Context, GxB_CONTEXT_TRACE, void **trace) ;
+//      GxB_set (GxB_Context Context, GxB_CONTEXT_TRACE_COOKIE, void *cookie) ;
+//      GxB_get (GxB_Context Context, GxB_CONTEXT_TRACE_COOKIE, void **cookie) ;
 
 // To get global options that can be queried but not modified:
 //
@@ -4704,6 +4815,45 @@ GrB_Info GrB_mxv                    // w<Mask> = accum (w, A*u)
     const GrB_Descriptor desc       // descriptor for w, mask, and A
 ) ;
 
+// GxB_vxm_batch and GxB_mxv_batch compute a batch of nbatch independent
+// vector-matrix or matrix-vector products that all share the same matrix A,
+// semiring, accum operator, and descriptor.  The kth result is identical to
+// GrB_vxm (w [k], Mask [k], accum, semiring, u [k], A, desc), or to GrB_mxv
+// (w [k], Mask [k], accum, semiring, A, u [k], desc), but the batch is
+// computed with a single matrix multiply, so A is traversed just once and the
+// per-call overhead is amortized over the whole batch.  This is useful for
+// many simultaneous BFS or SSSP traversals with small frontiers.
+
+// The w, Mask, and u arrays have size nbatch.  The Mask array may be NULL, in
+// which case no mask is used; otherwise all Mask [k] must be non-NULL.  All
+// w [k] must have the same type and length, and all u [k] must have the same
+// type and length.  The vectors w [k] must be distinct, but each may be
+// aliased with any of the inputs u [j] or Mask [j].
+
+GrB_Info GxB_vxm_batch              // w{k}'<Mask{k}> = accum (w{k}, u{k}'*A)
+(
+    GrB_Vector *w,                  // array of input/output vectors
+    const GrB_Vector *Mask,         // optional array of masks, may be NULL
+    const GrB_BinaryOp accum,       // optional accum for z=accum(w,t)
+    const GrB_Semiring semiring,    // defines '+' and '*' for u'*A
+    const GrB_Vector *u,            // array of first inputs: vectors u{k}
+    const GrB_Matrix A,             // second input: matrix A
+    const GrB_Index nbatch,         // # of vectors in w, Mask, and u
+    const GrB_Descriptor desc       // descriptor for w, mask, and A
+) ;
+
+GrB_Info GxB_mxv_batch              // w{k}<Mask{k}> = accum (w{k}, A*u{k})
+(
+    GrB_Vector *w,                  // array of input/output vectors
+    const GrB_Vector *Mask,         // optional array of masks, may be NULL
+    const GrB_BinaryOp accum,       // optional accum for z=accum(w,t)
+    const GrB_Semiring semiring,    // defines '+' and '*' for A*B
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Vector *u,            // array of second inputs: vectors u{k}
+    const GrB_Index nbatch,         // # of vectors in w, Mask, and u
+    const GrB_Descriptor desc       // descriptor for w, mask, and A
+) ;
+
 //==============================================================================
 // GrB_eWiseMult: element-wise matrix and vector operations, set intersection
 //==============================================================================
@@ -10926,6 +11076,32 @@ GrB_Info GrB_Matrix_deserialize     // deserialize blob into a GrB_Matrix
     GrB_Index blob_size     // size of the blob
 ) ;
 
+// GxB_Matrix_deserialize_shallow is identical to GxB_Matrix_deserialize,
+// except that any component of the blob that was serialized without
+// compression (with GxB_COMPRESSION_NONE) and that is suitably aligned is not
+// copied.  Instead, the matrix C refers directly to the blob, which must
+// remain valid and unmodified until C is freed.  This allows a matrix to be
+// loaded from a file with no copy at all, by mapping the file into memory
+// with mmap (or MapViewOfFile) and passing the mapped region as the blob.
+// The blob is never modified.  If C is later modified by any GraphBLAS
+// method, its shallow components are first copied (copy-on-write), so the
+// blob can be mapped read-only.  Compressed or misaligned components are
+// copied, just as they are by GxB_Matrix_deserialize.
+
+GrB_Info GxB_Matrix_deserialize_shallow // deserialize a blob, without copying
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the blob
+    // input:
+    GrB_Type type,      // type of the matrix C.  Required if the blob holds a
+                        // matrix of user-defined type.  May be NULL if blob
+                        // holds a built-in type; otherwise must match the
+                        // type of C.
+    const void *blob,       // the blob, which must not be freed until C is
+    GrB_Index blob_size,    // size of the blob
+    const GrB_Descriptor desc       // to control # of threads used
+) ;
+
 GrB_Info GxB_Vector_deserialize     // deserialize blob into a GrB_Vector
 (
     // output:
@@ -10958,6 +11134,83 @@ GrB_Info GxB_deserialize_type_name  // return the type name of a blob
     GrB_Index blob_size     // size of the blob
 ) ;
 
+// GxB_Matrix_serialize_stream and GxB_Matrix_deserialize_stream serialize a
+// matrix to, or deserialize a matrix from, a user-defined stream, such as a
+// file descriptor.  The stream has the same format as the blob created by
+// GxB_Matrix_serialize, but it is never held in memory all at once.  Each
+// array in the matrix is split into blocks, and the blocks are compressed (or
+// decompressed) in parallel, a few at a time, as they are written to (or read
+// from) the stream.  The header of the stream holds an index of the compressed
+// blocks, which is written last.  As a result, the write function must
+// support positional writes, such as pwrite for a file descriptor, and the
+// stream cannot be a pipe or socket.  The read and write functions must return
+// zero if successful, or nonzero on failure; GrB_INVALID_VALUE is then
+// returned.  Example usage, with a file descriptor as the cookie:
+
+/*
+    int my_write (void *cookie, const void *buffer, size_t size,
+        uint64_t offset)
+    {
+        int fd = *((int *) cookie) ;
+        return (pwrite (fd, buffer, size, offset) == size ? 0 : -1) ;
+    }
+    int my_read (void *cookie, void *buffer, size_t size, uint64_t offset)
+    {
+        int fd = *((int *) cookie) ;
+        return (pread (fd, buffer, size, offset) == size ? 0 : -1) ;
+    }
+
+    int fd = open ("myblob", O_WRONLY | O_CREAT | O_TRUNC, 0644) ;
+    GrB_Index blob_size ;
+    GxB_Matrix_serialize_stream (&blob_size, my_write, &fd, A, NULL) ;
+    close (fd) ;
+    fd = open ("myblob", O_RDONLY) ;
+    GxB_Matrix_deserialize_stream (&B, NULL, my_read, &fd, NULL) ;
+    close (fd) ;
+*/
+
+typedef int (*GxB_stream_write_function)
+(
+    void *cookie,               // user-defined object, such as a file
+    const void *buffer,         // bytes to write
+    size_t size,                // # of bytes to write
+    uint64_t offset             // position in the stream to write them
+) ;
+
+typedef int (*GxB_stream_read_function)
+(
+    void *cookie,               // user-defined object, such as a file
+    void *buffer,               // bytes to read
+    size_t size,                // # of bytes to read
+    uint64_t offset             // position in the stream to read them from
+) ;
+
+GrB_Info GxB_Matrix_serialize_stream    // serialize a GrB_Matrix to a stream
+(
+    // output:
+    GrB_Index *blob_size_handle,    // # of bytes written to the stream
+    // input:
+    GxB_stream_write_function writer,   // function to write to the stream
+    void *cookie,                   // passed to the writer
+    GrB_Matrix A,                   // matrix to serialize
+    const GrB_Descriptor desc       // descriptor to select compression method
+                                    // and to control # of threads used
+) ;
+
+GrB_Info GxB_Matrix_deserialize_stream  // deserialize a stream into a matrix
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the stream
+    // input:
+    GrB_Type type,      // type of the matrix C.  Required if the stream holds
+                        // a matrix of user-defined type.  May be NULL if the
+                        // stream holds a built-in type; otherwise must match
+                        // the type of C.
+    GxB_stream_read_function reader,    // function to read from the stream
+    void *cookie,                       // passed to the reader
+    const GrB_Descriptor desc           // to control # of threads used
+) ;
+
 //==============================================================================
 // GxB_Vector_sort and GxB_Matrix_sort: sort a matrix or vector
 //==============================================================================
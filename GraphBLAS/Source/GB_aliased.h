@@ -28,11 +28,18 @@ bool GB_all_aliased         // determine if A and B are all aliased
     GrB_Matrix B            // input B matrix
 ) ;
 
-// matrices returned to the user are never shallow; internal matrices may be
+// matrices returned to the user are never shallow, except for those created
+// by GxB_Matrix_deserialize_shallow; internal matrices may be shallow
 bool GB_is_shallow              // true if any component of A is shallow
 (
     GrB_Matrix A                // matrix to query
 ) ;
 
+// copy-on-write: a user matrix must not be shallow when it is modified
+GrB_Info GB_unshallow           // copy all shallow components of A
+(
+    GrB_Matrix A                // matrix to modify
+) ;
+
 #endif
 
@@ -167,8 +167,10 @@ GrB_Info GB_apply                   // C<M> = accum (C, op(A)) or op(A')
         }
     }
 
-    // check domains and dimensions for C<M> = accum (C,T)
     GrB_Info info ;
+    GB_OK (GB_unshallow (C)) ;         // copy-on-write, if C is shallow
+
+    // check domains and dimensions for C<M> = accum (C,T)
     GB_OK (GB_compatible (C->type, C, M, Mask_struct, accum, T_type, Werk)) ;
 
     // check the dimensions
@@ -111,7 +111,6 @@ GrB_Info GB_assign_prep
     GrB_Matrix A = A_in ;
 
     ASSERT_MATRIX_OK (C, "C input for GB_assign_prep", GB0) ;
-    ASSERT (!GB_is_shallow (C)) ;
     ASSERT_MATRIX_OK_OR_NULL (M, "M for GB_assign_prep", GB0) ;
     ASSERT_BINARYOP_OK_OR_NULL (accum, "accum for GB_assign_prep", GB0) ;
     ASSERT (scode <= GB_UDT_code) ;
@@ -126,6 +125,10 @@ GrB_Info GB_assign_prep
     GrB_Index *J2  = NULL ; size_t J2_size = 0 ;
     GrB_Index *I2k = NULL ; size_t I2k_size = 0 ;
     GrB_Index *J2k = NULL ; size_t J2k_size = 0 ;
+
+    GB_OK (GB_unshallow (C)) ;         // copy-on-write, if C is shallow
+    ASSERT (!GB_is_shallow (C)) ;
+
     (*scalar_type_handle) = NULL ;
 
     (*Chandle) = NULL ;
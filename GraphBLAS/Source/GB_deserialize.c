@@ -9,6 +9,10 @@
 
 // A parallel decompression of a serialized blob into a GrB_Matrix.
 
+// If shallow is true (for GxB_Matrix_deserialize_shallow), any component of
+// the blob that is not compressed and is suitably aligned is not copied.
+// Instead, the component of C is a shallow pointer into the blob.
+
 #include "GB.h"
 #include "GB_serialize.h"
 
@@ -25,7 +29,8 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     // input:
     GrB_Type type_expected,         // type expected (NULL for any built-in)
     const GB_void *blob,            // serialized matrix 
-    size_t blob_size                // size of the blob
+    size_t blob_size,               // size of the blob
+    bool shallow                    // if true, C may point into the blob
 )
 {
 
@@ -163,36 +168,36 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
         case GxB_HYPERSPARSE : 
             // decompress Cp, Ch, and Ci
             GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->p), &(C->p_size),
-                Cp_len, blob, blob_size, Cp_Sblocks, Cp_nblocks, Cp_method,
-                &s)) ;
+                &(C->p_shallow), Cp_len, blob, blob_size, Cp_Sblocks,
+                Cp_nblocks, Cp_method, shallow, &s)) ;
 
             GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->h), &(C->h_size),
-                Ch_len, blob, blob_size, Ch_Sblocks, Ch_nblocks, Ch_method,
-                &s)) ;
+                &(C->h_shallow), Ch_len, blob, blob_size, Ch_Sblocks,
+                Ch_nblocks, Ch_method, shallow, &s)) ;
 
             GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->i), &(C->i_size),
-                Ci_len, blob, blob_size, Ci_Sblocks, Ci_nblocks, Ci_method,
-                &s)) ;
+                &(C->i_shallow), Ci_len, blob, blob_size, Ci_Sblocks,
+                Ci_nblocks, Ci_method, shallow, &s)) ;
             break ;
 
         case GxB_SPARSE : 
 
             // decompress Cp and Ci
             GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->p), &(C->p_size),
-                Cp_len, blob, blob_size, Cp_Sblocks, Cp_nblocks, Cp_method,
-                &s)) ;
+                &(C->p_shallow), Cp_len, blob, blob_size, Cp_Sblocks,
+                Cp_nblocks, Cp_method, shallow, &s)) ;
 
             GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->i), &(C->i_size),
-                Ci_len, blob, blob_size, Ci_Sblocks, Ci_nblocks, Ci_method,
-                &s)) ;
+                &(C->i_shallow), Ci_len, blob, blob_size, Ci_Sblocks,
+                Ci_nblocks, Ci_method, shallow, &s)) ;
             break ;
 
         case GxB_BITMAP : 
 
             // decompress Cb
             GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->b), &(C->b_size),
-                Cb_len, blob, blob_size, Cb_Sblocks, Cb_nblocks, Cb_method,
-                &s)) ;
+                &(C->b_shallow), Cb_len, blob, blob_size, Cb_Sblocks,
+                Cb_nblocks, Cb_method, shallow, &s)) ;
             break ;
 
         case GxB_FULL : 
@@ -201,8 +206,9 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     }
 
     // decompress Cx
-    GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->x), &(C->x_size), Cx_len,
-        blob, blob_size, Cx_Sblocks, Cx_nblocks, Cx_method, &s)) ;
+    GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->x), &(C->x_size),
+        &(C->x_shallow), Cx_len, blob, blob_size, Cx_Sblocks,
+        Cx_nblocks, Cx_method, shallow, &s)) ;
 
     if (C->p != NULL)
     { 
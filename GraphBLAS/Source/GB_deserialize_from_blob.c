@@ -30,6 +30,7 @@ GrB_Info GB_deserialize_from_blob
     // output:
     GB_void **X_handle,         // uncompressed output array
     size_t *X_size_handle,      // size of X as allocated
+    bool *X_shallow_handle,     // true if X points into the blob
     // input:
     int64_t X_len,              // size of X in bytes
     const GB_void *blob,        // serialized blob of size blob_size
@@ -37,6 +38,7 @@ GrB_Info GB_deserialize_from_blob
     int64_t *Sblocks,           // array of size nblocks
     int32_t nblocks,            // # of compressed blocks for this array
     int32_t method,             // compression method used for each block
+    bool shallow,               // if true, X may point into the blob
     // input/output:
     size_t *s_handle            // where to read from the blob
 )
@@ -51,8 +53,10 @@ GrB_Info GB_deserialize_from_blob
     ASSERT (s_handle != NULL) ;
     ASSERT (X_handle != NULL) ;
     ASSERT (X_size_handle != NULL) ;
+    ASSERT (X_shallow_handle != NULL) ;
     (*X_handle) = NULL ;
     (*X_size_handle) = 0 ;
+    (*X_shallow_handle) = false ;
 
     //--------------------------------------------------------------------------
     // parse the method
@@ -61,6 +65,24 @@ GrB_Info GB_deserialize_from_blob
     int32_t algo, level ;
     GB_serialize_method (&algo, &level, method) ;
 
+    //--------------------------------------------------------------------------
+    // use the blob itself if uncompressed, aligned, and shallow is requested
+    //--------------------------------------------------------------------------
+
+    size_t s = (*s_handle) ;
+    if (shallow && algo == GxB_COMPRESSION_NONE && nblocks == 1
+        && X_len > 0 && Sblocks [0] == X_len && s + X_len <= blob_size
+        && ((uintptr_t) (blob + s)) % sizeof (int64_t) == 0)
+    { 
+        // X is a shallow pointer into the blob.  The blob is read-only;
+        // the matrix is copied (by GB_unshallow) before it is modified.
+        (*X_handle) = (GB_void *) (blob + s) ;
+        (*X_size_handle) = X_len ;
+        (*X_shallow_handle) = true ;
+        (*s_handle) = s + X_len ;
+        return (GrB_SUCCESS) ;
+    }
+
     //--------------------------------------------------------------------------
     // allocate the output array
     //--------------------------------------------------------------------------
@@ -83,7 +105,6 @@ GrB_Info GB_deserialize_from_blob
     // decompress the blocks from the blob
     //--------------------------------------------------------------------------
 
-    size_t s = (*s_handle) ;
     bool ok = true ;
 
     if (algo == GxB_COMPRESSION_NONE)
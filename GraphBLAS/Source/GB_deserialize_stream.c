@@ -0,0 +1,521 @@
+//------------------------------------------------------------------------------
+// GB_deserialize_stream: decompress and deserialize a stream into a GrB_Matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// A parallel streaming decompression of a serialized matrix into a GrB_Matrix.
+// The serialized matrix has the same format as the blob created by
+// GB_serialize or GB_serialize_stream, but it is read from the user's read
+// function, one wave of compressed blocks at a time, instead of being held in
+// memory all at once.  The header and the block index (the Sblocks array for
+// each component) are read first.  Then each wave of nthreads compressed
+// blocks is read, and decompressed in parallel directly into its place in the
+// output matrix.  The workspace is limited to nthreads compressed blocks.
+
+// The same sanity checks as GB_deserialize and GB_deserialize_from_blob are
+// done, so that a mangled stream cannot cause an out-of-bounds access.  The
+// contents of the output matrix are not fully checked, however.
+
+#include "GB.h"
+#include "GB_serialize.h"
+#include "GB_lz4.h"
+#include "GB_zstd.h"
+
+#define GB_FREE_ALL                             \
+{                                               \
+    GB_FREE_WORK (&W, W_size) ;                 \
+    GB_FREE (&X, X_size) ;                      \
+}
+
+//------------------------------------------------------------------------------
+// GB_stream_read_array: read and decompress a single array from the stream
+//------------------------------------------------------------------------------
+
+static GrB_Info GB_stream_read_array
+(
+    // output:
+    GB_void **X_handle,             // uncompressed output array
+    size_t *X_size_handle,          // size of X as allocated
+    // input/output:
+    uint64_t *offset_handle,        // where to read from the stream
+    // input:
+    GxB_stream_read_function reader,    // user-provided read function
+    void *cookie,                   // passed to the reader
+    uint64_t blob_size,             // total size of the stream
+    int64_t X_len,                  // size of X in bytes
+    const int64_t *Sblocks,         // array of size nblocks
+    int32_t nblocks,                // # of compressed blocks for this array
+    int32_t method                  // compression method used for each block
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (X_handle != NULL) ;
+    ASSERT (X_size_handle != NULL) ;
+    (*X_handle) = NULL ;
+    (*X_size_handle) = 0 ;
+    GB_void *W = NULL ; size_t W_size = 0 ;
+    GB_void *X = NULL ; size_t X_size = 0 ;
+    uint64_t offset = (*offset_handle) ;
+
+    if (X_len < 0 || nblocks < 0 || (nblocks == 0 && X_len > 0))
+    {
+        // stream is invalid
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // parse the method
+    //--------------------------------------------------------------------------
+
+    int32_t algo, level ;
+    GB_serialize_method (&algo, &level, method) ;
+
+    //--------------------------------------------------------------------------
+    // allocate the output array
+    //--------------------------------------------------------------------------
+
+    X = GB_MALLOC (X_len, GB_void, &X_size) ;  // OK
+    if (X == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    if (nblocks == 0)
+    {
+        // the array is empty
+        (*X_handle) = X ;
+        (*X_size_handle) = X_size ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // read the array as-is if not compressed
+    //--------------------------------------------------------------------------
+
+    if (algo == GxB_COMPRESSION_NONE)
+    {
+        if (nblocks > 1 || Sblocks [0] != X_len || offset + X_len > blob_size)
+        {
+            // stream is invalid: guard against an unsafe read
+            GB_FREE_ALL ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+        if (reader (cookie, X, (size_t) X_len, offset) != 0)
+        {
+            // the user's read function failed
+            GB_FREE_ALL ;
+            return (GrB_INVALID_VALUE) ;
+        }
+        (*X_handle) = X ;
+        (*X_size_handle) = X_size ;
+        (*offset_handle) = offset + X_len ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check the block index and find the largest compressed block
+    //--------------------------------------------------------------------------
+
+    int64_t smax = 0 ;
+    for (int32_t blockid = 0 ; blockid < nblocks ; blockid++)
+    {
+        int64_t kstart, kend ;
+        GB_PARTITION (kstart, kend, X_len, blockid, nblocks) ;
+        int64_t s_start = (blockid == 0) ? 0 : Sblocks [blockid-1] ;
+        int64_t s_end   = Sblocks [blockid] ;
+        if (kstart < 0 || kend < 0 || s_start < 0 || s_end < 0 ||
+            kstart >= kend || s_start >= s_end ||
+            s_end - s_start > INT32_MAX || kend - kstart > INT32_MAX ||
+            offset + s_end > blob_size || kend > X_len)
+        {
+            // stream is invalid
+            GB_FREE_ALL ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+        smax = GB_IMAX (smax, s_end - s_start) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate workspace for one wave of nthreads compressed blocks
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    int nthreads = GB_IMIN (nthreads_max, nblocks) ;
+    W = GB_MALLOC_WORK (nthreads * smax, GB_void, &W_size) ;
+    if (W == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // read and decompress the blocks, nthreads blocks at a time
+    //--------------------------------------------------------------------------
+
+    bool ok = true ;
+    for (int32_t wave = 0 ; wave < nblocks ; wave += nthreads)
+    {
+
+        //----------------------------------------------------------------------
+        // read blocks wave:wave+nwave-1, in order
+        //----------------------------------------------------------------------
+
+        int nwave = (int) GB_IMIN (nthreads, nblocks - wave) ;
+        int t ;
+        for (t = 0 ; t < nwave ; t++)
+        {
+            int32_t blockid = wave + t ;
+            int64_t s_start = (blockid == 0) ? 0 : Sblocks [blockid-1] ;
+            int64_t s_end   = Sblocks [blockid] ;
+            if (reader (cookie, W + t * smax, (size_t) (s_end - s_start),
+                offset + s_start) != 0)
+            {
+                // the user's read function failed
+                GB_FREE_ALL ;
+                return (GrB_INVALID_VALUE) ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // decompress the blocks in parallel
+        //----------------------------------------------------------------------
+
+        #pragma omp parallel for num_threads(nwave) schedule(static,1) \
+            reduction(&&:ok)
+        for (t = 0 ; t < nwave ; t++)
+        {
+            // uncompress the compressed block of size s_size from
+            // W [t*smax ...] into X [kstart:kend-1].  The block index has
+            // already been checked above.
+            int32_t blockid = wave + t ;
+            int64_t kstart, kend ;
+            GB_PARTITION (kstart, kend, X_len, blockid, nblocks) ;
+            int64_t s_start = (blockid == 0) ? 0 : Sblocks [blockid-1] ;
+            int64_t s_end   = Sblocks [blockid] ;
+            size_t  s_size  = s_end - s_start ;
+            size_t  d_size  = kend - kstart ;
+            const char *src = (const char *) (W + t * smax) ;
+            char *dst = (char *) (X + kstart) ;
+            if (algo == GxB_COMPRESSION_ZSTD)
+            {
+                // ZSTD
+                size_t u = ZSTD_decompress (dst, d_size, src, s_size) ;
+                ok = ok && (u == d_size) ;
+            }
+            else
+            {
+                // LZ4 or LZ4HC
+                int src_size = (int) s_size ;
+                int dst_size = (int) d_size ;
+                int u = LZ4_decompress_safe (src, dst, src_size, dst_size) ;
+                ok = ok && (u == dst_size) ;
+            }
+        }
+
+        if (!ok)
+        {
+            // decompression failure; stream is invalid
+            GB_FREE_ALL ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORK (&W, W_size) ;
+    (*X_handle) = X ;
+    (*X_size_handle) = X_size ;
+    (*offset_handle) = offset + Sblocks [nblocks-1] ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_deserialize_stream: deserialize a matrix from a stream
+//------------------------------------------------------------------------------
+
+#undef  GB_FREE_ALL
+#define GB_FREE_ALL                             \
+{                                               \
+    GB_FREE_WORK (&blob, blob_size_allocated) ; \
+    GB_FREE_WORK (&Sblocks, Sblocks_size) ;     \
+    GB_Matrix_free (&C) ;                       \
+}
+
+GrB_Info GB_deserialize_stream      // deserialize a matrix from a stream
+(
+    // output:
+    GrB_Matrix *Chandle,            // output matrix created from the stream
+    // input:
+    GrB_Type type_expected,         // type expected (NULL for any built-in)
+    GxB_stream_read_function reader,    // user-provided read function
+    void *cookie                    // passed to the reader
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (Chandle != NULL && reader != NULL) ;
+    (*Chandle) = NULL ;
+    GrB_Matrix C = NULL ;
+    GB_void *blob = NULL ; size_t blob_size_allocated = 0 ;
+    int64_t *Sblocks = NULL ; size_t Sblocks_size = 0 ;
+
+    //--------------------------------------------------------------------------
+    // read the header (160 bytes) and the type_name (128 bytes), if present
+    //--------------------------------------------------------------------------
+
+    blob = GB_MALLOC_WORK (GB_BLOB_HEADER_SIZE + GxB_MAX_NAME_LEN, GB_void,
+        &blob_size_allocated) ;
+    if (blob == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    if (reader (cookie, blob, GB_BLOB_HEADER_SIZE, 0) != 0)
+    {
+        // the user's read function failed
+        GB_FREE_ALL ;
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    size_t s = 0 ;
+    GB_BLOB_READ (blob_size, uint64_t) ;
+    GB_BLOB_READ (typecode, int32_t) ;
+
+    if (blob_size < GB_BLOB_HEADER_SIZE
+        || typecode < GB_BOOL_code || typecode > GB_UDT_code
+        || (typecode == GB_UDT_code &&
+            blob_size < GB_BLOB_HEADER_SIZE + GxB_MAX_NAME_LEN))
+    {
+        // stream is invalid
+        GB_FREE_ALL ;
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    GB_BLOB_READ (version, int32_t) ;
+    GB_BLOB_READ (vlen, int64_t) ;
+    GB_BLOB_READ (vdim, int64_t) ;
+    GB_BLOB_READ (nvec, int64_t) ;
+    GB_BLOB_READ (nvec_nonempty, int64_t) ;
+    GB_BLOB_READ (nvals, int64_t) ;
+    GB_BLOB_READ (typesize, int64_t) ;
+    GB_BLOB_READ (Cp_len, int64_t) ;
+    GB_BLOB_READ (Ch_len, int64_t) ;
+    GB_BLOB_READ (Cb_len, int64_t) ;
+    GB_BLOB_READ (Ci_len, int64_t) ;
+    GB_BLOB_READ (Cx_len, int64_t) ;
+    GB_BLOB_READ (hyper_switch, float) ;
+    GB_BLOB_READ (bitmap_switch, float) ;
+    GB_BLOB_READ (sparsity_control, int32_t) ;
+    GB_BLOB_READ (sparsity_iso_csc, int32_t) ;
+    GB_BLOB_READ (Cp_nblocks, int32_t) ; GB_BLOB_READ (Cp_method, int32_t) ;
+    GB_BLOB_READ (Ch_nblocks, int32_t) ; GB_BLOB_READ (Ch_method, int32_t) ;
+    GB_BLOB_READ (Cb_nblocks, int32_t) ; GB_BLOB_READ (Cb_method, int32_t) ;
+    GB_BLOB_READ (Ci_nblocks, int32_t) ; GB_BLOB_READ (Ci_method, int32_t) ;
+    GB_BLOB_READ (Cx_nblocks, int32_t) ; GB_BLOB_READ (Cx_method, int32_t) ;
+
+    int32_t sparsity = sparsity_iso_csc / 4 ;
+    bool iso = ((sparsity_iso_csc & 2) == 2) ;
+    bool is_csc = ((sparsity_iso_csc & 1) == 1) ;
+
+    //--------------------------------------------------------------------------
+    // determine the matrix type
+    //--------------------------------------------------------------------------
+
+    GB_Type_code ccode = (GB_Type_code) typecode ;
+    GrB_Type ctype = GB_code_type (ccode, type_expected) ;
+
+    // ensure the type has the right size
+    if (ctype == NULL || ctype->size != typesize)
+    {
+        // stream is invalid; type is missing or the wrong size
+        GB_FREE_ALL ;
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    if (ccode == GB_UDT_code)
+    {
+        // user-defined name is 128 bytes, if present
+        // ensure the user-defined type has the right name
+        ASSERT (ctype == type_expected) ;
+        if (reader (cookie, blob + s, GxB_MAX_NAME_LEN, s) != 0)
+        {
+            // the user's read function failed
+            GB_FREE_ALL ;
+            return (GrB_INVALID_VALUE) ;
+        }
+        if (strncmp ((const char *) (blob + s), ctype->name,
+            GxB_MAX_NAME_LEN) != 0)
+        {
+            // stream is invalid
+            GB_FREE_ALL ;
+            return (GrB_DOMAIN_MISMATCH) ;
+        }
+        s += GxB_MAX_NAME_LEN ;
+    }
+    else if (type_expected != NULL && ctype != type_expected)
+    {
+        // built-in type must match type_expected
+        GB_FREE_ALL ;
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // read the block index for each array
+    //--------------------------------------------------------------------------
+
+    if (Cp_nblocks < 0 || Ch_nblocks < 0 || Cb_nblocks < 0 || Ci_nblocks < 0
+        || Cx_nblocks < 0)
+    {
+        // stream is invalid
+        GB_FREE_ALL ;
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    int64_t nblocks_all = (int64_t) Cp_nblocks + (int64_t) Ch_nblocks
+        + (int64_t) Cb_nblocks + (int64_t) Ci_nblocks + (int64_t) Cx_nblocks ;
+    size_t index_size = nblocks_all * sizeof (int64_t) ;
+    if (s + index_size > blob_size)
+    {
+        // stream is invalid
+        GB_FREE_ALL ;
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    Sblocks = GB_MALLOC_WORK (nblocks_all + 1, int64_t, &Sblocks_size) ;
+    if (Sblocks == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    if (index_size > 0 && reader (cookie, Sblocks, index_size, s) != 0)
+    {
+        // the user's read function failed
+        GB_FREE_ALL ;
+        return (GrB_INVALID_VALUE) ;
+    }
+    uint64_t offset = s + index_size ;
+
+    int64_t *Cp_Sblocks = Sblocks ;
+    int64_t *Ch_Sblocks = Cp_Sblocks + Cp_nblocks ;
+    int64_t *Cb_Sblocks = Ch_Sblocks + Ch_nblocks ;
+    int64_t *Ci_Sblocks = Cb_Sblocks + Cb_nblocks ;
+    int64_t *Cx_Sblocks = Ci_Sblocks + Ci_nblocks ;
+
+    //--------------------------------------------------------------------------
+    // allocate the output matrix C
+    //--------------------------------------------------------------------------
+
+    // allocate the matrix with info from the header
+    GB_OK (GB_new (&C,  // new header (C is NULL on input)
+        ctype, vlen, vdim, GB_Ap_null, is_csc,
+        sparsity, hyper_switch, nvec)) ;
+
+    C->nvec = nvec ;
+    C->nvec_nonempty = nvec_nonempty ;
+    C->nvals = nvals ;      // revised below
+    C->bitmap_switch = bitmap_switch ;
+    C->sparsity_control = sparsity_control ;
+    C->iso = iso ;
+
+    // the matrix has no pending work
+    ASSERT (C->Pending == NULL) ;
+    ASSERT (C->nzombies == 0) ;
+    ASSERT (!C->jumbled) ;
+
+    //--------------------------------------------------------------------------
+    // read and decompress each array (Cp, Ch, Cb, Ci, and Cx)
+    //--------------------------------------------------------------------------
+
+    switch (sparsity)
+    {
+        case GxB_HYPERSPARSE :
+            // decompress Cp, Ch, and Ci
+            GB_OK (GB_stream_read_array ((GB_void **) &(C->p), &(C->p_size),
+                &offset, reader, cookie, blob_size, Cp_len, Cp_Sblocks,
+                Cp_nblocks, Cp_method)) ;
+
+            GB_OK (GB_stream_read_array ((GB_void **) &(C->h), &(C->h_size),
+                &offset, reader, cookie, blob_size, Ch_len, Ch_Sblocks,
+                Ch_nblocks, Ch_method)) ;
+
+            GB_OK (GB_stream_read_array ((GB_void **) &(C->i), &(C->i_size),
+                &offset, reader, cookie, blob_size, Ci_len, Ci_Sblocks,
+                Ci_nblocks, Ci_method)) ;
+            break ;
+
+        case GxB_SPARSE :
+            // decompress Cp and Ci
+            GB_OK (GB_stream_read_array ((GB_void **) &(C->p), &(C->p_size),
+                &offset, reader, cookie, blob_size, Cp_len, Cp_Sblocks,
+                Cp_nblocks, Cp_method)) ;
+
+            GB_OK (GB_stream_read_array ((GB_void **) &(C->i), &(C->i_size),
+                &offset, reader, cookie, blob_size, Ci_len, Ci_Sblocks,
+                Ci_nblocks, Ci_method)) ;
+            break ;
+
+        case GxB_BITMAP :
+            // decompress Cb
+            GB_OK (GB_stream_read_array ((GB_void **) &(C->b), &(C->b_size),
+                &offset, reader, cookie, blob_size, Cb_len, Cb_Sblocks,
+                Cb_nblocks, Cb_method)) ;
+            break ;
+
+        case GxB_FULL :
+            break ;
+
+        default:
+            // stream is invalid
+            GB_FREE_ALL ;
+            return (GrB_INVALID_OBJECT) ;
+    }
+
+    // decompress Cx
+    GB_OK (GB_stream_read_array ((GB_void **) &(C->x), &(C->x_size),
+        &offset, reader, cookie, blob_size, Cx_len, Cx_Sblocks,
+        Cx_nblocks, Cx_method)) ;
+
+    if (C->p != NULL)
+    {
+        // C is sparse or hypersparse; see GB_deserialize
+        if (Cp_len != (nvec+1) * sizeof (int64_t))
+        {
+            // stream is invalid
+            GB_FREE_ALL ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+        C->nvals = C->p [C->nvec] ;
+    }
+    C->magic = GB_MAGIC ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORK (&blob, blob_size_allocated) ;
+    GB_FREE_WORK (&Sblocks, Sblocks_size) ;
+    (*Chandle) = C ;
+    ASSERT_MATRIX_OK (*Chandle, "Final result from deserialize stream", GB0) ;
+    return (GrB_SUCCESS) ;
+}
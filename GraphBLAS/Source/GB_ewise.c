@@ -61,6 +61,7 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
     GB_RETURN_IF_FAULTY_OR_POSITIONAL (accum) ;
 
     ASSERT_MATRIX_OK (C, "C input for GB_ewise", GB0) ;
+    GB_OK (GB_unshallow (C)) ;         // copy-on-write, if C is shallow
     ASSERT_MATRIX_OK_OR_NULL (M, "M for GB_ewise", GB0) ;
     ASSERT_BINARYOP_OK_OR_NULL (accum, "accum for GB_ewise", GB0) ;
     ASSERT_BINARYOP_OK (op_in, "op for GB_ewise", GB0) ;
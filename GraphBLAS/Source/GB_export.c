@@ -69,6 +69,7 @@ GrB_Info GB_export      // export/unpack a matrix in any format
     ASSERT (A != NULL) ;
     GB_RETURN_IF_NULL_OR_FAULTY (*A) ;
     ASSERT_MATRIX_OK (*A, "A to export", GB0) ;
+    GB_OK (GB_unshallow (*A)) ;        // the user must own all of A
     ASSERT (!GB_ZOMBIES (*A)) ;
     ASSERT (GB_JUMBLED_OK (*A)) ;
     ASSERT (!GB_PENDING (*A)) ;
@@ -55,6 +55,7 @@ GrB_Info GB_extract                 // C<M> = accum (C, A(I,J))
     GB_RETURN_IF_FAULTY_OR_POSITIONAL (accum) ;
 
     ASSERT_MATRIX_OK (C, "C input for GB_Matrix_extract", GB0) ;
+    GB_OK (GB_unshallow (C)) ;         // copy-on-write, if C is shallow
     ASSERT_MATRIX_OK_OR_NULL (M, "M for GB_Matrix_extract", GB0) ;
     ASSERT_BINARYOP_OK_OR_NULL (accum, "accum for GB_Matrix_extract", GB0) ;
     ASSERT_MATRIX_OK (A, "A input for GB_Matrix_extract", GB0) ;
@@ -0,0 +1,222 @@
+//------------------------------------------------------------------------------
+// GB_ingest: merge an array of matrices into C
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C = dup (C, Pieces{0}, ..., Pieces{npieces-1}), where each piece is a matrix
+// of the same dimensions as C that has been filled by a single user thread,
+// typically with many calls to GrB_Matrix_setElement.  The pieces are cleared
+// on output.
+
+// The pending work in each piece (pending tuples, zombies, and jumbled
+// vectors) is finished first, with one call to GB_wait per piece, where all
+// pieces are finished in parallel.  The pieces are then merged with GB_add in
+// a balanced tree of depth ceil(log2(npieces)), and the result T is added to
+// C, so that each entry is added O(log(npieces)) times rather than once per
+// piece.  Each GB_add is itself parallel.  If npieces is 1, this is just
+// C = dup (C, Pieces{0}).
+
+// The intermediate results have the type of the dup operator.  If dup is
+// NULL, SECOND_CTYPE is used.
+
+#define GB_FREE_WORKSPACE                                       \
+{                                                               \
+    GB_Matrix_free (&S) ;                                       \
+    if (Work != NULL)                                           \
+    {                                                           \
+        for (int64_t k = 0 ; k < npieces ; k++)                 \
+        {                                                       \
+            GB_Matrix_free (&(Work [k])) ;                      \
+        }                                                       \
+    }                                                           \
+    GB_FREE_WORK (&Work, Work_size) ;                           \
+    GB_FREE_WORK (&Work_header, Work_header_size) ;             \
+}
+
+#define GB_FREE_ALL GB_FREE_WORKSPACE
+
+#include "GB_ingest.h"
+#include "GB_add.h"
+#include "GB_binop.h"
+#include "GB_transpose.h"
+
+GrB_Info GB_ingest                  // merge an array of matrices into C
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_BinaryOp dup,         // operator for duplicates, or NULL
+    GrB_Matrix *Pieces,             // array of size npieces; cleared on output
+    const int64_t npieces,
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GrB_Matrix *Work = NULL ; size_t Work_size = 0 ;
+    struct GB_Matrix_opaque *Work_header = NULL ; size_t Work_header_size = 0 ;
+    struct GB_Matrix_opaque S_header ;
+    GrB_Matrix S = NULL ;
+
+    ASSERT_MATRIX_OK (C, "C input for GB_ingest", GB0) ;
+    ASSERT (npieces > 0) ;
+
+    // get the dup operator; SECOND_CTYPE if NULL
+    struct GB_BinaryOp_opaque op_header ;
+    GrB_BinaryOp op = (dup == NULL) ? GB_binop_second (C->type, &op_header) :
+        dup ;
+    ASSERT_BINARYOP_OK (op, "op for GB_ingest", GB0) ;
+    if (op->xtype != op->ztype || op->ytype != op->ztype)
+    {
+        // all 3 types of z = dup (x,y) must be the same, as in GrB_build
+        GB_ERROR (GrB_DOMAIN_MISMATCH, "All domains of dup operator must be "
+            "identical.\noperator is: [%s] = %s ([%s],[%s])",
+            op->ztype->name, op->name, op->xtype->name, op->ytype->name) ;
+    }
+    GB_OK (GB_BinaryOp_compatible (op, C->type, C->type, NULL, GB_ignore_code,
+        Werk)) ;
+
+    for (int64_t k = 0 ; k < npieces ; k++)
+    {
+        GrB_Matrix P = Pieces [k] ;
+        GB_RETURN_IF_NULL_OR_FAULTY (P) ;
+        if (GB_NROWS (P) != GB_NROWS (C) || GB_NCOLS (P) != GB_NCOLS (C))
+        {
+            GB_ERROR (GrB_DIMENSION_MISMATCH, "Pieces{" GBd "} is " GBd "-by-"
+                GBd "; must be " GBd "-by-" GBd, k, GB_NROWS (P),
+                GB_NCOLS (P), GB_NROWS (C), GB_NCOLS (C)) ;
+        }
+        if (!GB_Type_compatible (P->type, op->ytype))
+        {
+            GB_ERROR (GrB_DOMAIN_MISMATCH, "Pieces{" GBd "} of type [%s] "
+                "cannot be typecast to [%s]", k, P->type->name,
+                op->ytype->name) ;
+        }
+        if (P == C)
+        { 
+            GB_ERROR (GrB_INVALID_VALUE, "Pieces{" GBd "} cannot be C", k) ;
+        }
+        for (int64_t j = 0 ; j < k ; j++)
+        {
+            if (P == Pieces [j])
+            { 
+                // the pieces are finished in parallel; they must be distinct
+                GB_ERROR (GrB_INVALID_VALUE, "Pieces{" GBd "} and Pieces{" GBd
+                    "} cannot be the same matrix", j, k) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // finish the pending work of C and of each piece, in parallel
+    //--------------------------------------------------------------------------
+
+    GB_MATRIX_WAIT (C) ;
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    int nthreads = (int) GB_IMIN (npieces, nthreads_max) ;
+    GBURBLE ("(" GBd " pieces) ", npieces) ;
+
+    // Each piece is finished by a call to GB_wait with its own Werk, and each
+    // is converted to the same format (by row or by column) as C.  GraphBLAS
+    // may be called by many user threads at the same time, on independent
+    // matrices, so this is safe.  The parallel loops inside GB_wait use a
+    // single thread each, if nested parallelism is disabled.
+    int piece_info = GrB_SUCCESS ;
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
+        reduction(min:piece_info)
+    for (k = 0 ; k < npieces ; k++)
+    {
+        GrB_Matrix P = Pieces [k] ;
+        GB_WERK ("GxB_Matrix_ingest") ;
+        GrB_Info pinfo = GrB_SUCCESS ;
+        if (GB_ANY_PENDING_WORK (P))
+        {
+            pinfo = GB_wait (P, "piece", Werk) ;
+        }
+        if (pinfo == GrB_SUCCESS && P->is_csc != C->is_csc)
+        {
+            pinfo = GB_transpose_in_place (P, C->is_csc, Werk) ;
+        }
+        piece_info = GB_IMIN (piece_info, (int) pinfo) ;
+    }
+    GB_OK ((GrB_Info) piece_info) ;
+
+    //--------------------------------------------------------------------------
+    // T = dup (Pieces{0}, ..., Pieces{npieces-1}), in a balanced tree
+    //--------------------------------------------------------------------------
+
+    // Work [k] is NULL if the kth result is still the unmodified Pieces{k}.
+    // Otherwise, it is an intermediate result.  There are npieces-1 merges in
+    // all, and the result of the mth merge is held in Work_header [m].
+
+    if (npieces > 1)
+    {
+        Work = GB_CALLOC_WORK (npieces, GrB_Matrix, &Work_size) ;
+        Work_header = GB_MALLOC_WORK (npieces-1, struct GB_Matrix_opaque,
+            &Work_header_size) ;
+        if (Work == NULL || Work_header == NULL)
+        { 
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+    }
+
+    bool ignore ;
+    int64_t nmerged = 0 ;
+    for (int64_t width = 1 ; width < npieces ; width *= 2)
+    {
+        for (int64_t k = 0 ; k + width < npieces ; k += 2*width)
+        { 
+            // T{k} = dup (T{k}, T{k+width})
+            GrB_Matrix A = (Work [k] != NULL) ? Work [k] : Pieces [k] ;
+            GrB_Matrix B = (Work [k+width] != NULL) ? Work [k+width] :
+                Pieces [k+width] ;
+            GB_CLEAR_STATIC_HEADER (S, &(Work_header [nmerged++])) ;
+            GB_OK (GB_add (S, op->ztype, C->is_csc, NULL, false, false,
+                &ignore, A, B, false, NULL, NULL, op, false, Werk)) ;
+            GB_Matrix_free (&(Work [k])) ;
+            GB_Matrix_free (&(Work [k+width])) ;
+            Work [k] = S ;
+            S = NULL ;
+            ASSERT_MATRIX_OK (Work [k], "T{k} merged for GB_ingest", GB0) ;
+        }
+    }
+    ASSERT (nmerged == npieces-1) ;
+
+    GrB_Matrix T = (npieces > 1) ? Work [0] : Pieces [0] ;
+    ASSERT_MATRIX_OK (T, "T for GB_ingest", GB0) ;
+
+    //--------------------------------------------------------------------------
+    // C = dup (C, T)
+    //--------------------------------------------------------------------------
+
+    if (GB_nnz (T) > 0)
+    {
+        GB_CLEAR_STATIC_HEADER (S, &S_header) ;
+        GB_OK (GB_add (S, C->type, C->is_csc, NULL, false, false, &ignore,
+            C, T, false, NULL, NULL, op, false, Werk)) ;
+        GB_OK (GB_transplant_conform (C, C->type, &S, Werk)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // clear the pieces, free workspace, and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    for (int64_t k = 0 ; k < npieces ; k++)
+    {
+        GB_OK (GB_clear (Pieces [k], Werk)) ;
+    }
+    ASSERT_MATRIX_OK (C, "C output for GB_ingest", GB0) ;
+    return (GrB_SUCCESS) ;
+}
+
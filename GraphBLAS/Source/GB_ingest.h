@@ -0,0 +1,24 @@
+//------------------------------------------------------------------------------
+// GB_ingest.h: definitions for GxB_Matrix_ingest
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#ifndef GB_INGEST_H
+#define GB_INGEST_H
+#include "GB.h"
+
+GrB_Info GB_ingest                  // merge an array of matrices into C
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_BinaryOp dup,         // operator for duplicates, or NULL
+    GrB_Matrix *Pieces,             // array of size npieces; cleared on output
+    const int64_t npieces,
+    GB_Werk Werk
+) ;
+
+#endif
+
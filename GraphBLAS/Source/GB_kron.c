@@ -64,6 +64,7 @@ GrB_Info GB_kron                    // C<M> = accum (C, kron(A,B))
     GB_RETURN_IF_FAULTY_OR_POSITIONAL (accum) ;
 
     ASSERT_MATRIX_OK (C, "C input for GB_kron", GB0) ;
+    GB_OK (GB_unshallow (C)) ;         // copy-on-write, if C is shallow
     ASSERT_MATRIX_OK_OR_NULL (M, "M for GB_kron", GB0) ;
     ASSERT_BINARYOP_OK_OR_NULL (accum, "accum for GB_kron", GB0) ;
     ASSERT_BINARYOP_OK (op, "op for GB_kron", GB0) ;
@@ -135,6 +135,10 @@ void GB_macrofy_mxm        // construct all macros for GrB_mxm
     bool is_first  = (mult->opcode == GB_FIRST_binop_code) ;
     bool is_second = (mult->opcode == GB_SECOND_binop_code) ;
     bool is_pair   = (mult->opcode == GB_PAIR_binop_code) ;
+    bool is_plus_times_avx = (addop->opcode == GB_PLUS_binop_code &&
+        mult->opcode == GB_TIMES_binop_code &&
+        (is_float || is_double || zcode == GB_INT64_code ||
+        zcode == GB_UINT64_code)) ;
 
     if (C_iso)
     { 
@@ -148,7 +152,7 @@ void GB_macrofy_mxm        // construct all macros for GrB_mxm
     }
     else if (u_expr != NULL && f_expr != NULL &&
         (is_float || is_double || is_bool || is_first || is_second || is_pair
-            || is_positional))
+            || is_positional || is_plus_times_avx))
     { 
 
         //----------------------------------------------------------------------
@@ -162,6 +166,8 @@ void GB_macrofy_mxm        // construct all macros for GrB_mxm
         // bool is OK since promotion of the result (0 or 1) to int is safe.
         // first and second are OK since no promotion occurs.
         // positional operators are OK too.
+        // int64 and uint64 do not get promoted, and PLUS_TIMES on these types
+        // needs a fused multiply-add for the AVX-based saxpy5 method.
 
         // Since GB_MULT is not used, the fused GB_MULTADD must handle flipxy.
 
@@ -291,13 +297,11 @@ void GB_macrofy_mxm        // construct all macros for GrB_mxm
         }
 
     }
-    else if (addop->opcode == GB_PLUS_binop_code &&
-              mult->opcode == GB_TIMES_binop_code &&
-            (zcode == GB_FP32_code || zcode == GB_FP64_code))
+    else if (is_plus_times_avx)
     { 
 
         //----------------------------------------------------------------------
-        // semiring is PLUS_TIMES_FP32 or PLUS_TIMES_FP64
+        // semiring is PLUS_TIMES_FP32, FP64, INT64, or UINT64
         //----------------------------------------------------------------------
 
         // future:: try AVX acceleration on more semirings
@@ -56,6 +56,7 @@ GrB_Info GB_mxm                     // C<M> = A*B
     GB_RETURN_IF_NULL_OR_FAULTY (semiring) ;
 
     ASSERT_MATRIX_OK (C, "C input for GB_mxm", GB0) ;
+    GB_OK (GB_unshallow (C)) ;         // copy-on-write, if C is shallow
     ASSERT_MATRIX_OK_OR_NULL (M_input, "M for GB_mxm", GB0) ;
     ASSERT_BINARYOP_OK_OR_NULL (accum, "accum for GB_mxm", GB0) ;
     ASSERT_SEMIRING_OK (semiring, "semiring for GB_mxm", GB0) ;
@@ -33,6 +33,25 @@ GrB_Info GB_mxm                     // C<M> = A*B
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_mxv_batch               // W{k}<M{k}> = A*U{k}, for all k
+(
+    GrB_Vector *W,                  // array of input/output vectors
+    const GrB_Vector *Mask,         // optional array of masks, may be NULL
+    const int64_t nbatch,           // # of vectors in W, Mask, and U
+    const bool C_replace,           // if true, clear each W{k} first
+    const bool Mask_comp,           // if true, use !M{k}
+    const bool Mask_struct,         // if true, use the only structure of M{k}
+    const GrB_BinaryOp accum,       // optional accum for z=accum(w,t)
+    const GrB_Semiring semiring,    // defines '+' and '*' for each A*u
+    const GrB_Matrix A,             // input matrix, shared by all vectors
+    const bool A_transpose,         // if true, use A' instead of A
+    const GrB_Vector *U,            // array of input vectors
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    const GrB_Desc_Value AxB_method,// for auto vs user selection of methods
+    const int do_sort,              // if nonzero, try to return W{k} sorted
+    GB_Werk Werk
+) ;
+
 GrB_Info GB_AxB_dot                 // dot product (multiple methods)
 (
     GrB_Matrix C,                   // output matrix, static header
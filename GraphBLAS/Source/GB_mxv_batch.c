@@ -0,0 +1,246 @@
+//------------------------------------------------------------------------------
+// GB_mxv_batch: batched matrix-vector multiply for GxB_mxv_batch and vxm_batch
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// W{k}<M{k}> = accum (W{k}, A*U{k}) for k = 0 to nbatch-1, and variations.
+
+// This function is not user-callable.  It does the work for the user-callable
+// functions GxB_mxv_batch and GxB_vxm_batch.
+
+// Each batch of nbatch calls to GrB_mxv (or GrB_vxm) that share the same
+// matrix A, semiring, accum operator, and descriptor is computed with a single
+// call to GB_mxm.  The vectors W{k}, U{k}, and M{k} are concatenated into the
+// n-by-nbatch matrices C, B, and M, respectively, and C<M>=accum(C,A*B) is
+// computed.  The result C is then split back into the output vectors W{k}.
+// This traverses A once for the whole batch, and all of the per-call overhead
+// (the analysis in GB_AxB_meta, the choice of method, the JIT lookup, and the
+// slicing of A) is done just once.  The saxpy-based methods treat the columns
+// of B as independent frontiers and schedule threads across all of them.
+
+// The masks M{k} must either all be present, or the Mask array must be NULL
+// (or all of its entries NULL).  The vectors W{k} must all have the same type,
+// and likewise for the vectors U{k}.  All of the inputs are read before any
+// output vector W{k} is modified, so W{k} may be aliased with any input U{j}
+// or M{j}.  The results are undefined if W contains duplicate vectors.  If an
+// error occurs (out of memory, for example), all of the vectors W{:} are left
+// unchanged.
+
+#define GB_FREE_WORKSPACE                               \
+{                                                       \
+    GB_Matrix_free (&C) ;                               \
+    GB_Matrix_free (&M) ;                               \
+    GB_Matrix_free (&B) ;                               \
+    if (Tiles != NULL)                                  \
+    {                                                   \
+        for (int64_t k = 0 ; k < nbatch ; k++)          \
+        {                                               \
+            GB_Matrix_free (&(Tiles [k])) ;             \
+        }                                               \
+    }                                                   \
+    GB_FREE_WORK (&Tiles, Tiles_size) ;                 \
+    GB_FREE_WORK (&Tile_ncols, Tile_ncols_size) ;       \
+}
+
+#define GB_FREE_ALL GB_FREE_WORKSPACE
+
+#include "GB_mxm.h"
+#include "GB_concat.h"
+#include "GB_split.h"
+#include "GB_get_mask.h"
+
+GrB_Info GB_mxv_batch               // W{k}<M{k}> = A*U{k}, for all k
+(
+    GrB_Vector *W,                  // array of input/output vectors
+    const GrB_Vector *Mask,         // optional array of masks, may be NULL
+    const int64_t nbatch,           // # of vectors in W, Mask, and U
+    const bool C_replace,           // if true, clear each W{k} first
+    const bool Mask_comp_in,        // if true, use !M{k}
+    const bool Mask_struct_in,      // if true, use the only structure of M{k}
+    const GrB_BinaryOp accum,       // optional accum for z=accum(w,t)
+    const GrB_Semiring semiring,    // defines '+' and '*' for each A*u
+    const GrB_Matrix A,             // input matrix, shared by all vectors
+    const bool A_transpose,         // if true, use A' instead of A
+    const GrB_Vector *U,            // array of input vectors
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    const GrB_Desc_Value AxB_method,// for auto vs user selection of methods
+    const int do_sort,              // if nonzero, try to return W{k} sorted
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GrB_Matrix C = NULL, M = NULL, B = NULL ;
+    GrB_Matrix *Tiles = NULL ; size_t Tiles_size = 0 ;
+    GrB_Index *Tile_ncols = NULL ; size_t Tile_ncols_size = 0 ;
+
+    GB_RETURN_IF_NULL (W) ;
+    GB_RETURN_IF_NULL (U) ;
+    if (nbatch <= 0)
+    {
+        GB_ERROR (GrB_INVALID_VALUE, "nbatch (" GBd ") must be > 0", nbatch) ;
+    }
+    ASSERT_MATRIX_OK (A, "A for GB_mxv_batch", GB0) ;
+
+    GrB_Type wtype = W [0]->type ;
+    GrB_Type utype = U [0]->type ;
+    GrB_Type mtype = NULL ;
+    int64_t wlen = GB_NROWS (W [0]) ;
+    int64_t ulen = GB_NROWS (U [0]) ;
+    bool has_mask = (Mask != NULL && Mask [0] != NULL) ;
+    if (has_mask)
+    {
+        mtype = Mask [0]->type ;
+    }
+
+    for (int64_t k = 0 ; k < nbatch ; k++)
+    {
+        GrB_Vector w = W [k] ;
+        GrB_Vector u = U [k] ;
+        GrB_Vector m = (Mask == NULL) ? NULL : Mask [k] ;
+        GB_RETURN_IF_NULL_OR_FAULTY (w) ;
+        GB_RETURN_IF_NULL_OR_FAULTY (u) ;
+        GB_RETURN_IF_FAULTY (m) ;
+        ASSERT (GB_VECTOR_OK (w)) ;
+        ASSERT (GB_VECTOR_OK (u)) ;
+        ASSERT (m == NULL || GB_VECTOR_OK (m)) ;
+        if ((m != NULL) != has_mask)
+        {
+            GB_ERROR (GrB_INVALID_VALUE, "Mask{" GBd "} is %s; the masks must "
+                "either all be present or all be NULL", k,
+                has_mask ? "NULL" : "present") ;
+        }
+        if (w->type != wtype || u->type != utype)
+        {
+            GB_ERROR (GrB_DOMAIN_MISMATCH, "W{" GBd "} and U{" GBd "} must "
+                "have the same types as W{0} and U{0}: [%s] and [%s]", k, k,
+                wtype->name, utype->name) ;
+        }
+        if (GB_NROWS (w) != wlen || GB_NROWS (u) != ulen ||
+            (m != NULL && GB_NROWS (m) != wlen))
+        {
+            GB_ERROR (GrB_DIMENSION_MISMATCH, "W{" GBd "}, U{" GBd "}, and "
+                "M{" GBd "} must have the same lengths as W{0} and U{0}: "
+                GBd " and " GBd, k, k, k, wlen, ulen) ;
+        }
+        if (m != NULL && m->type != mtype)
+        {
+            // the masks have different types; cast them all to boolean
+            mtype = GrB_BOOL ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    GBURBLE ("(batch of " GBd ") ", nbatch) ;
+    Tiles = GB_CALLOC_WORK (nbatch, GrB_Matrix, &Tiles_size) ;
+    Tile_ncols = GB_MALLOC_WORK (nbatch, GrB_Index, &Tile_ncols_size) ;
+    if (Tiles == NULL || Tile_ncols == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    for (int64_t k = 0 ; k < nbatch ; k++)
+    {
+        Tile_ncols [k] = 1 ;
+    }
+
+    //--------------------------------------------------------------------------
+    // C = [W{:}], B = [U{:}], and M = [M{:}]
+    //--------------------------------------------------------------------------
+
+    float hyper_switch = GB_Global_hyper_switch_get ( ) ;
+    GB_OK (GB_new (&C, // auto sparsity, new header
+        wtype, wlen, nbatch, GB_Ap_calloc, true, GxB_AUTO_SPARSITY,
+        hyper_switch, 1)) ;
+    GB_OK (GB_concat (C, (GrB_Matrix *) W, 1, nbatch, Werk)) ;
+
+    GB_OK (GB_new (&B, // auto sparsity, new header
+        utype, ulen, nbatch, GB_Ap_calloc, true, GxB_AUTO_SPARSITY,
+        hyper_switch, 1)) ;
+    GB_OK (GB_concat (B, (GrB_Matrix *) U, 1, nbatch, Werk)) ;
+
+    if (has_mask)
+    {
+        GB_OK (GB_new (&M, // auto sparsity, new header
+            mtype, wlen, nbatch, GB_Ap_calloc, true, GxB_AUTO_SPARSITY,
+            hyper_switch, 1)) ;
+        GB_OK (GB_concat (M, (GrB_Matrix *) Mask, 1, nbatch, Werk)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // C<M> = accum (C,A*B), using a single mxm for the whole batch
+    //--------------------------------------------------------------------------
+
+    bool Mask_comp = Mask_comp_in ;
+    bool Mask_struct = Mask_struct_in ;
+    GrB_Matrix M_get = GB_get_mask (M, &Mask_comp, &Mask_struct) ;
+
+    GB_OK (GB_mxm (
+        C,                  C_replace,      // C and its descriptor
+        M_get, Mask_comp, Mask_struct,      // mask and its descriptor
+        accum,                              // for accum (C,T)
+        semiring,                           // definition of matrix multiply
+        A,                  A_transpose,    // allow A to be transposed
+        B,                  false,          // B is never transposed
+        flipxy,                             // fmult(y,x) if flipxy is true
+        AxB_method, do_sort,                // algorithm selector
+        Werk)) ;
+
+    //--------------------------------------------------------------------------
+    // [W{:}] = C
+    //--------------------------------------------------------------------------
+
+    GrB_Index Tile_nrows [1] ;
+    Tile_nrows [0] = wlen ;
+    GB_OK (GB_split (Tiles, 1, nbatch, Tile_nrows, Tile_ncols, C, Werk)) ;
+    GB_Matrix_free (&C) ;
+
+    // Conform each tile to the sparsity structure that W{k} requires, so
+    // that everything that can fail is done before any W{k} is modified.
+    // If an error occurs here, all of the outputs W{:} are left unchanged.
+    for (int64_t k = 0 ; k < nbatch ; k++)
+    {
+        GrB_Matrix w = (GrB_Matrix) W [k] ;
+        GrB_Matrix T = Tiles [k] ;
+        T->sparsity_control = w->sparsity_control ;
+        T->hyper_switch = w->hyper_switch ;
+        T->bitmap_switch = w->bitmap_switch ;
+        GB_OK (GB_conform (T, Werk)) ;
+    }
+
+    // Each tile has the type of W{k} and no shallow content, so transplanting
+    // it cannot fail.
+    for (int64_t k = 0 ; k < nbatch ; k++)
+    {
+        GrB_Matrix w = (GrB_Matrix) W [k] ;
+        if (GB_is_shallow (w))
+        { 
+            // W{k} is replaced, so its shallow content need not be copied
+            GB_phybix_free (w) ;
+        }
+        ASSERT (Tiles [k]->type == wtype && !GB_is_shallow (Tiles [k])) ;
+        info = GB_transplant (w, wtype, &(Tiles [k]), Werk) ;
+        ASSERT (info == GrB_SUCCESS) ;
+        ASSERT_VECTOR_OK ((GrB_Vector) w, "W{k} output for GB_mxv_batch",
+            GB0) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    return (GrB_SUCCESS) ;
+}
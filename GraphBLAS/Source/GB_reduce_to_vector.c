@@ -67,6 +67,8 @@ GrB_Info GB_reduce_to_vector        // C<M> = accum (C,reduce(A))
     // get the mask
     GrB_Matrix M = GB_get_mask (M_in, &Mask_comp, &Mask_struct) ;
 
+    GB_OK (GB_unshallow (C)) ;         // copy-on-write, if C is shallow
+
     // check domains and dimensions for C<M> = accum (C,T)
     GrB_Type ztype = monoid->op->ztype ;
     GB_OK (GB_compatible (C->type, C, M, Mask_struct, accum, ztype, Werk)) ;
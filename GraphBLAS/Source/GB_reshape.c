@@ -94,6 +94,12 @@ GrB_Info GB_reshape         // reshape a GrB_Matrix into another GrB_Matrix
         return (GrB_DIMENSION_MISMATCH) ;
     }
 
+    if (in_place)
+    { 
+        // copy-on-write, if A is shallow
+        GB_OK (GB_unshallow (A)) ;
+    }
+
     //--------------------------------------------------------------------------
     // finish any pending work, and transpose the input matrix if needed
     //--------------------------------------------------------------------------
@@ -40,6 +40,7 @@ GrB_Info GB_resize              // change the size of a matrix
     GB_void *restrict Ax_new = NULL ; size_t Ax_new_size = 0 ;
     int8_t  *restrict Ab_new = NULL ; size_t Ab_new_size = 0 ;
     ASSERT_MATRIX_OK (A, "A to resize", GB0) ;
+    GB_OK (GB_unshallow (A)) ;         // copy-on-write, if A is shallow
 
     //--------------------------------------------------------------------------
     // handle the CSR/CSC format
@@ -56,8 +56,10 @@ GrB_Info GB_select          // C<M> = accum (C, select(A,k)) or select(A',k)
     struct GB_Matrix_opaque T_header ;
     GrB_Matrix T = NULL ;
 
-    // check domains and dimensions for C<M> = accum (C,T)
     GrB_Info info ;
+    GB_OK (GB_unshallow (C)) ;         // copy-on-write, if C is shallow
+
+    // check domains and dimensions for C<M> = accum (C,T)
     GB_OK (GB_compatible (C->type, C, M, Mask_struct, accum, A->type, Werk));
 
     GB_Type_code xcode = (op->xtype == NULL) ? GB_ignore_code : op->xtype->code;
@@ -37,7 +37,8 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     // input:
     GrB_Type type_expected,         // type expected (NULL for any built-in)
     const GB_void *blob,            // serialized matrix 
-    size_t blob_size                // size of the blob
+    size_t blob_size,               // size of the blob
+    bool shallow                    // if true, C may point into the blob
 ) ;
 
 typedef struct
@@ -92,6 +93,7 @@ GrB_Info GB_deserialize_from_blob
     // output:
     GB_void **X_handle,         // uncompressed output array
     size_t *X_size_handle,      // size of X as allocated
+    bool *X_shallow_handle,     // true if X points into the blob
     // input:
     int64_t X_len,              // size of X in bytes
     const GB_void *blob,        // serialized blob of size blob_size
@@ -99,10 +101,36 @@ GrB_Info GB_deserialize_from_blob
     int64_t *Sblocks,           // array of size nblocks
     int32_t nblocks,            // # of compressed blocks for this array
     int32_t method_used,        // compression method used for each block
+    bool shallow,               // if true, X may point into the blob
     // input/output:
     size_t *s_handle            // where to read from the blob
 ) ;
 
+GrB_Info GB_serialize_stream        // serialize a matrix to a stream
+(
+    // output:
+    uint64_t *blob_size_handle,     // # of bytes written to the stream
+    // input:
+    GxB_stream_write_function writer,   // user-provided write function
+    void *cookie,                   // passed to the writer
+    const GrB_Matrix A,             // matrix to serialize
+    int32_t method,                 // method to use
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_deserialize_stream      // deserialize a matrix from a stream
+(
+    // output:
+    GrB_Matrix *Chandle,            // output matrix created from the stream
+    // input:
+    GrB_Type type_expected,         // type expected (NULL for any built-in)
+    GxB_stream_read_function reader,    // user-provided read function
+    void *cookie                    // passed to the reader
+) ;
+
+// largest uncompressed block for GB_serialize_stream (16 MB)
+#define GB_SERIALIZE_STREAM_BLOCKSIZE (16 * 1024 * 1024)
+
 #define GB_BLOB_HEADER_SIZE \
     sizeof (uint64_t)           /* blob_size                            */ \
     + 11 * sizeof (int64_t)     /* vlen, vdim, nvec, nvec_nonempty,     */ \
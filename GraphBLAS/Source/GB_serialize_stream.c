@@ -0,0 +1,511 @@
+//------------------------------------------------------------------------------
+// GB_serialize_stream: compress and serialize a GrB_Matrix to a stream
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// A parallel streaming compression method for a GrB_Matrix.  The result is
+// identical in format to the blob created by GB_serialize, but it is never
+// held in memory all at once.  Instead, each array (Ap, Ah, Ab, Ai, and Ax) is
+// split into blocks of at most GB_SERIALIZE_STREAM_BLOCKSIZE bytes.  The
+// blocks are compressed in parallel, in waves of nthreads blocks at a time,
+// and each wave is handed to the user's write function before the next wave
+// is compressed.  The workspace is thus limited to nthreads compressed blocks,
+// no matter how large the matrix is.
+
+// The size of each compressed block is not known until it has been compressed,
+// so the header and the block index (the Sblocks array for each component) are
+// written last, at the start of the stream.  The write function must thus
+// support positional writes, as pwrite does for a file descriptor.  The
+// resulting stream can be read by GB_deserialize_stream, or loaded into memory
+// and passed to GxB_Matrix_deserialize or GrB_Matrix_deserialize.
+
+#include "GB.h"
+#include "GB_serialize.h"
+#include "GB_lz4.h"
+#include "GB_zstd.h"
+
+#define GB_FREE_ALL                             \
+{                                               \
+    GB_FREE_WORK (&W, W_size) ;                 \
+}
+
+//------------------------------------------------------------------------------
+// GB_stream_plan: determine the # of blocks for a single array
+//------------------------------------------------------------------------------
+
+static void GB_stream_plan
+(
+    // output:
+    int32_t *nblocks_handle,        // # of blocks
+    int32_t *method_used,           // method used
+    int *nthreads_handle,           // # of threads to compress the blocks
+    // input:
+    int64_t len,                    // size of the array, in bytes
+    int32_t method                  // compression method requested
+)
+{
+
+    (*nblocks_handle) = 0 ;
+    (*method_used) = GxB_COMPRESSION_NONE ;
+    (*nthreads_handle) = 1 ;
+    if (len == 0)
+    {
+        // input array is empty
+        return ;
+    }
+
+    if (method <= GxB_COMPRESSION_NONE || len < 256)
+    {
+        // no compression; the array is written as a single block
+        (*nblocks_handle) = 1 ;
+        return ;
+    }
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (len, chunk, nthreads_max) ;
+
+    // 4 blocks per thread, but no larger than GB_SERIALIZE_STREAM_BLOCKSIZE
+    // and no smaller than 64KB.  Unlike GB_serialize_array, the blocks are
+    // kept small even with a single thread, so that the workspace is bounded.
+    int64_t blocksize = GB_ICEIL (len, 4*nthreads) ;
+    ASSERT (GB_SERIALIZE_STREAM_BLOCKSIZE <= LZ4_MAX_INPUT_SIZE/2) ;
+    blocksize = GB_IMIN (blocksize, GB_SERIALIZE_STREAM_BLOCKSIZE) ;
+    blocksize = GB_IMAX (blocksize, (64*1024)) ;
+    int64_t nblocks = GB_ICEIL (len, blocksize) ;
+    ASSERT (nblocks < INT32_MAX) ;
+
+    (*nblocks_handle) = (int32_t) nblocks ;
+    (*method_used) = method ;
+    (*nthreads_handle) = (int) GB_IMIN (nthreads, nblocks) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_stream_array: compress and write a single array to the stream
+//------------------------------------------------------------------------------
+
+static GrB_Info GB_stream_array
+(
+    // output:
+    int64_t *Sblocks,               // array of size nblocks+1
+    // input/output:
+    uint64_t *offset_handle,        // where to write to the stream
+    // input:
+    GxB_stream_write_function writer,   // user-provided write function
+    void *cookie,                   // passed to the writer
+    const GB_void *X,               // input array of size len
+    int64_t len,                    // size of X, in bytes
+    int32_t nblocks,                // # of blocks, from GB_stream_plan
+    int32_t method_used,            // method, from GB_stream_plan
+    int nthreads,                   // # of threads, from GB_stream_plan
+    int32_t algo,                   // compression algorithm
+    int32_t level,                  // compression level
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check for quick return
+    //--------------------------------------------------------------------------
+
+    GB_void *W = NULL ; size_t W_size = 0 ;
+    uint64_t offset = (*offset_handle) ;
+    if (nblocks == 0)
+    {
+        // input array is empty
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // write the array as-is if not compressed
+    //--------------------------------------------------------------------------
+
+    if (method_used == GxB_COMPRESSION_NONE)
+    {
+        ASSERT (nblocks == 1) ;
+        if (writer (cookie, X, (size_t) len, offset) != 0)
+        {
+            // the user's write function failed
+            return (GrB_INVALID_VALUE) ;
+        }
+        Sblocks [0] = 0 ;
+        Sblocks [1] = len ;
+        (*offset_handle) = offset + len ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate workspace for one wave of nthreads compressed blocks
+    //--------------------------------------------------------------------------
+
+    int64_t umax = GB_ICEIL (len, nblocks) ;   // largest uncompressed block
+    ASSERT (umax < INT32_MAX) ;
+    size_t bound ;
+    switch (algo)
+    {
+        case GxB_COMPRESSION_LZ4 :
+        case GxB_COMPRESSION_LZ4HC :
+            bound = (size_t) LZ4_compressBound ((int) umax) ;
+            break ;
+        default :
+        case GxB_COMPRESSION_ZSTD :
+            bound = ZSTD_compressBound ((size_t) umax) ;
+            break ;
+    }
+    ASSERT (bound < INT32_MAX) ;
+
+    W = GB_MALLOC_WORK (nthreads * bound, GB_void, &W_size) ;
+    if (W == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // compress and write the blocks, nthreads blocks at a time
+    //--------------------------------------------------------------------------
+
+    bool ok = true ;
+    for (int32_t wave = 0 ; wave < nblocks ; wave += nthreads)
+    {
+
+        //----------------------------------------------------------------------
+        // compress blocks wave:wave+nwave-1 in parallel
+        //----------------------------------------------------------------------
+
+        int nwave = (int) GB_IMIN (nthreads, nblocks - wave) ;
+        int t ;
+        #pragma omp parallel for num_threads(nwave) schedule(static,1) \
+            reduction(&&:ok)
+        for (t = 0 ; t < nwave ; t++)
+        {
+            // compress X [kstart:kend-1] into W [t*bound ...]
+            int32_t blockid = wave + t ;
+            int64_t kstart, kend ;
+            GB_PARTITION (kstart, kend, len, blockid, nblocks) ;
+            const char *src = (const char *) (X + kstart) ;
+            char *dst = (char *) (W + t * bound) ;
+            int srcSize = (int) (kend - kstart) ;
+            int dstCapacity = (int) bound ;
+            int s ;
+            size_t s64 ;
+            switch (algo)
+            {
+
+                case GxB_COMPRESSION_LZ4 :
+                    s = LZ4_compress_default (src, dst, srcSize, dstCapacity) ;
+                    ok = ok && (s > 0) ;
+                    Sblocks [blockid] = (int64_t) s ;
+                    break ;
+
+                case GxB_COMPRESSION_LZ4HC :
+                    s = LZ4_compress_HC (src, dst, srcSize, dstCapacity,
+                        level) ;
+                    ok = ok && (s > 0) ;
+                    Sblocks [blockid] = (int64_t) s ;
+                    break ;
+
+                default :
+                case GxB_COMPRESSION_ZSTD :
+                    s64 = ZSTD_compress (dst, dstCapacity, src, srcSize,
+                        level) ;
+                    ok = ok && (s64 <= dstCapacity) ;
+                    Sblocks [blockid] = (int64_t) s64 ;
+                    break ;
+            }
+        }
+
+        if (!ok)
+        {
+            // compression failure: this can "never" occur
+            GB_FREE_ALL ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+
+        //----------------------------------------------------------------------
+        // write the compressed blocks, in order
+        //----------------------------------------------------------------------
+
+        for (t = 0 ; t < nwave ; t++)
+        {
+            size_t s = (size_t) Sblocks [wave + t] ;
+            if (writer (cookie, W + t * bound, s, offset) != 0)
+            {
+                // the user's write function failed
+                GB_FREE_ALL ;
+                return (GrB_INVALID_VALUE) ;
+            }
+            offset += s ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // compute cumulative sum of the compressed blocks
+    //--------------------------------------------------------------------------
+
+    GB_cumsum (Sblocks, nblocks, NULL, 1, Werk) ;
+    ASSERT (offset == (*offset_handle) + Sblocks [nblocks]) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_ALL ;
+    (*offset_handle) = offset ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_serialize_stream: serialize a matrix to a stream
+//------------------------------------------------------------------------------
+
+#undef  GB_FREE_ALL
+#define GB_FREE_ALL                             \
+{                                               \
+    GB_FREE_WORK (&Sblocks, Sblocks_size) ;     \
+    GB_FREE_WORK (&blob, blob_size_allocated) ; \
+}
+
+GrB_Info GB_serialize_stream        // serialize a matrix to a stream
+(
+    // output:
+    uint64_t *blob_size_handle,     // # of bytes written to the stream
+    // input:
+    GxB_stream_write_function writer,   // user-provided write function
+    void *cookie,                   // passed to the writer
+    const GrB_Matrix A,             // matrix to serialize
+    int32_t method,                 // method to use
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (blob_size_handle != NULL) ;
+    ASSERT (writer != NULL) ;
+    ASSERT_MATRIX_OK (A, "A for serialize stream", GB0) ;
+    (*blob_size_handle) = 0 ;
+    int64_t *Sblocks = NULL ; size_t Sblocks_size = 0 ;
+    GB_void *blob = NULL ; size_t blob_size_allocated = 0 ;
+
+    //--------------------------------------------------------------------------
+    // ensure all pending work is finished
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_wait (A, "A to serialize", Werk)) ;
+    ASSERT (A->nvec_nonempty >= 0) ;
+
+    //--------------------------------------------------------------------------
+    // parse the method
+    //--------------------------------------------------------------------------
+
+    int32_t algo, level ;
+    GB_serialize_method (&algo, &level, method) ;
+    method = algo + level ;
+    GBURBLE ("(stream compression: %s%s%s%s:%d) ",
+        (algo == GxB_COMPRESSION_NONE ) ? "none" : "",
+        (algo == GxB_COMPRESSION_LZ4  ) ? "LZ4" : "",
+        (algo == GxB_COMPRESSION_LZ4HC) ? "LZ4HC" : "",
+        (algo == GxB_COMPRESSION_ZSTD ) ? "ZSTD" : "",
+        level) ;
+
+    //--------------------------------------------------------------------------
+    // get the content of the matrix
+    //--------------------------------------------------------------------------
+
+    int32_t version = GxB_IMPLEMENTATION ;
+    int64_t vlen = A->vlen ;
+    int64_t vdim = A->vdim ;
+    int64_t nvec = A->nvec ;
+    int64_t nvals = A->nvals ;
+    int64_t nvec_nonempty = A->nvec_nonempty ;
+    int32_t sparsity = GB_sparsity (A) ;
+    bool iso = A->iso ;
+    float hyper_switch = A->hyper_switch ;
+    float bitmap_switch = A->bitmap_switch ;
+    int32_t sparsity_control = A->sparsity_control ;
+    ASSERT (A->Pending == NULL) ;
+    ASSERT (A->nzombies == 0) ;
+    ASSERT (!A->jumbled) ;
+    GrB_Type atype = A->type ;
+    int64_t typesize = atype->size ;
+    int32_t typecode = (int32_t) (atype->code) ;
+    int64_t anz = GB_nnz (A) ;
+    int64_t anz_held = GB_nnz_held (A) ;
+
+    // determine the uncompressed sizes of Ap, Ah, Ab, Ai, and Ax
+    int64_t Ap_len = 0 ;
+    int64_t Ah_len = 0 ;
+    int64_t Ab_len = 0 ;
+    int64_t Ai_len = 0 ;
+    int64_t Ax_len = 0 ;
+    switch (sparsity)
+    {
+        case GxB_HYPERSPARSE :
+            Ah_len = sizeof (GrB_Index) * nvec ;
+            // fall through to the sparse case
+        case GxB_SPARSE :
+            Ap_len = sizeof (GrB_Index) * (nvec+1) ;
+            Ai_len = sizeof (GrB_Index) * anz ;
+            Ax_len = typesize * (iso ? 1 : anz) ;
+            break ;
+        case GxB_BITMAP :
+            Ab_len = sizeof (int8_t) * anz_held ;
+            // fall through to the full case
+        case GxB_FULL :
+            Ax_len = typesize * (iso ? 1 : anz_held) ;
+            break ;
+        default: ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine the blocks for each array (Ap, Ah, Ab, Ai, and Ax)
+    //--------------------------------------------------------------------------
+
+    int32_t Ap_nblocks, Ah_nblocks, Ab_nblocks, Ai_nblocks, Ax_nblocks ;
+    int32_t Ap_method, Ah_method, Ab_method, Ai_method, Ax_method ;
+    int Ap_nthreads, Ah_nthreads, Ab_nthreads, Ai_nthreads, Ax_nthreads ;
+    GB_stream_plan (&Ap_nblocks, &Ap_method, &Ap_nthreads, Ap_len, method) ;
+    GB_stream_plan (&Ah_nblocks, &Ah_method, &Ah_nthreads, Ah_len, method) ;
+    GB_stream_plan (&Ab_nblocks, &Ab_method, &Ab_nthreads, Ab_len, method) ;
+    GB_stream_plan (&Ai_nblocks, &Ai_method, &Ai_nthreads, Ai_len, method) ;
+    GB_stream_plan (&Ax_nblocks, &Ax_method, &Ax_nthreads, Ax_len, method) ;
+
+    // allocate the Sblocks for all 5 arrays, each of size nblocks+1
+    int64_t nblocks_all = (int64_t) Ap_nblocks + (int64_t) Ah_nblocks
+        + (int64_t) Ab_nblocks + (int64_t) Ai_nblocks + (int64_t) Ax_nblocks ;
+    Sblocks = GB_CALLOC_WORK (nblocks_all + 5, int64_t, &Sblocks_size) ;
+    if (Sblocks == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    int64_t *Ap_Sblocks = Sblocks ;
+    int64_t *Ah_Sblocks = Ap_Sblocks + Ap_nblocks + 1 ;
+    int64_t *Ab_Sblocks = Ah_Sblocks + Ah_nblocks + 1 ;
+    int64_t *Ai_Sblocks = Ab_Sblocks + Ab_nblocks + 1 ;
+    int64_t *Ax_Sblocks = Ai_Sblocks + Ai_nblocks + 1 ;
+
+    //--------------------------------------------------------------------------
+    // compress and write each array, after space reserved for the header
+    //--------------------------------------------------------------------------
+
+    size_t header_size =
+        // header information
+        GB_BLOB_HEADER_SIZE
+        // Sblocks for each array
+        + nblocks_all * sizeof (int64_t)
+        // type_name for user-defined types
+        + ((typecode == GB_UDT_code) ? GxB_MAX_NAME_LEN : 0) ;
+
+    uint64_t offset = (uint64_t) header_size ;
+
+    GB_OK (GB_stream_array (Ap_Sblocks, &offset, writer, cookie,
+        (GB_void *) A->p, Ap_len, Ap_nblocks, Ap_method, Ap_nthreads,
+        algo, level, Werk)) ;
+
+    GB_OK (GB_stream_array (Ah_Sblocks, &offset, writer, cookie,
+        (GB_void *) A->h, Ah_len, Ah_nblocks, Ah_method, Ah_nthreads,
+        algo, level, Werk)) ;
+
+    GB_OK (GB_stream_array (Ab_Sblocks, &offset, writer, cookie,
+        (GB_void *) A->b, Ab_len, Ab_nblocks, Ab_method, Ab_nthreads,
+        algo, level, Werk)) ;
+
+    GB_OK (GB_stream_array (Ai_Sblocks, &offset, writer, cookie,
+        (GB_void *) A->i, Ai_len, Ai_nblocks, Ai_method, Ai_nthreads,
+        algo, level, Werk)) ;
+
+    GB_OK (GB_stream_array (Ax_Sblocks, &offset, writer, cookie,
+        (GB_void *) A->x, Ax_len, Ax_nblocks, Ax_method, Ax_nthreads,
+        algo, level, Werk)) ;
+
+    //--------------------------------------------------------------------------
+    // construct the header, type_name, and block index
+    //--------------------------------------------------------------------------
+
+    blob = GB_MALLOC_WORK (header_size, GB_void, &blob_size_allocated) ;
+    if (blob == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    size_t s = 0 ;
+    int32_t sparsity_iso_csc = (4 * sparsity) + (iso ? 2 : 0) +
+        (A->is_csc ? 1 : 0) ;
+
+    uint64_t blob_size = offset ;
+    GB_BLOB_WRITE (blob_size, uint64_t) ;
+    GB_BLOB_WRITE (typecode, int32_t) ;
+    GB_BLOB_WRITE (version, int32_t) ;
+    GB_BLOB_WRITE (vlen, int64_t) ;
+    GB_BLOB_WRITE (vdim, int64_t) ;
+    GB_BLOB_WRITE (nvec, int64_t) ;
+    GB_BLOB_WRITE (nvec_nonempty, int64_t) ;
+    GB_BLOB_WRITE (nvals, int64_t) ;
+    GB_BLOB_WRITE (typesize, int64_t) ;
+    GB_BLOB_WRITE (Ap_len, int64_t) ;
+    GB_BLOB_WRITE (Ah_len, int64_t) ;
+    GB_BLOB_WRITE (Ab_len, int64_t) ;
+    GB_BLOB_WRITE (Ai_len, int64_t) ;
+    GB_BLOB_WRITE (Ax_len, int64_t) ;
+    GB_BLOB_WRITE (hyper_switch, float) ;
+    GB_BLOB_WRITE (bitmap_switch, float) ;
+    GB_BLOB_WRITE (sparsity_control, int32_t) ;
+    GB_BLOB_WRITE (sparsity_iso_csc, int32_t);
+    GB_BLOB_WRITE (Ap_nblocks, int32_t) ; GB_BLOB_WRITE (Ap_method, int32_t) ;
+    GB_BLOB_WRITE (Ah_nblocks, int32_t) ; GB_BLOB_WRITE (Ah_method, int32_t) ;
+    GB_BLOB_WRITE (Ab_nblocks, int32_t) ; GB_BLOB_WRITE (Ab_method, int32_t) ;
+    GB_BLOB_WRITE (Ai_nblocks, int32_t) ; GB_BLOB_WRITE (Ai_method, int32_t) ;
+    GB_BLOB_WRITE (Ax_nblocks, int32_t) ; GB_BLOB_WRITE (Ax_method, int32_t) ;
+
+    if (typecode == GB_UDT_code)
+    {
+        // only copy the type_name for user-defined types
+        memset (blob + s, 0, GxB_MAX_NAME_LEN) ;
+        #if GB_COMPILER_GCC
+        #if (__GNUC__ > 5)
+        #pragma GCC diagnostic ignored "-Wstringop-truncation"
+        #endif
+        #endif
+        strncpy ((char *) (blob + s), atype->name, GxB_MAX_NAME_LEN-1) ;
+        s += GxB_MAX_NAME_LEN ;
+    }
+
+    GB_BLOB_WRITES (Ap_Sblocks, Ap_nblocks) ;
+    GB_BLOB_WRITES (Ah_Sblocks, Ah_nblocks) ;
+    GB_BLOB_WRITES (Ab_Sblocks, Ab_nblocks) ;
+    GB_BLOB_WRITES (Ai_Sblocks, Ai_nblocks) ;
+    GB_BLOB_WRITES (Ax_Sblocks, Ax_nblocks) ;
+    ASSERT (s == header_size) ;
+
+    //--------------------------------------------------------------------------
+    // write the header at the start of the stream
+    //--------------------------------------------------------------------------
+
+    if (writer (cookie, blob, header_size, 0) != 0)
+    {
+        // the user's write function failed
+        GB_FREE_ALL ;
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_ALL ;
+    (*blob_size_handle) = blob_size ;
+    return (GrB_SUCCESS) ;
+}
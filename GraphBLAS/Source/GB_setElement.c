@@ -89,6 +89,8 @@ GrB_Info GB_setElement              // set a single entry, C(row,col) = scalar
             Werk)) ;
     }
 
+    GB_OK (GB_unshallow (C)) ;         // copy-on-write, if C is shallow
+
     // pending tuples and zombies are expected, and C might be jumbled too
     ASSERT (GB_JUMBLED_OK (C)) ;
     ASSERT (GB_PENDING_OK (C)) ;
@@ -273,6 +273,11 @@ GrB_Info GB_sort
     { 
         GB_phybix_free (C) ;
     }
+    else
+    { 
+        // copy-on-write, if C is shallow
+        GB_OK (GB_unshallow (C)) ;
+    }
 
     //--------------------------------------------------------------------------
     // make a copy of A, unless it is aliased with C
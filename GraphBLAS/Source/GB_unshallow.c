@@ -0,0 +1,104 @@
+//------------------------------------------------------------------------------
+// GB_unshallow: copy any shallow components of a matrix (copy-on-write)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A matrix created by GxB_Matrix_deserialize_shallow may have components that
+// point into a read-only blob owned by the user application, such as a file
+// mapped into memory with mmap.  Such a matrix can be used as an input to any
+// method.  Before a method modifies the matrix, it calls GB_unshallow, which
+// makes a private copy of each shallow component.  The hyper_hash A->Y is
+// freed if it is shallow, since it can be rebuilt when needed.
+
+#include "GB.h"
+
+#define GB_FREE_ALL                 \
+{                                   \
+    GB_FREE (&Ap, Ap_size) ;        \
+    GB_FREE (&Ah, Ah_size) ;        \
+    GB_FREE (&Ab, Ab_size) ;        \
+    GB_FREE (&Ai, Ai_size) ;        \
+    GB_FREE (&Ax, Ax_size) ;        \
+}
+
+// copy the A->X component if it is shallow
+#define GB_UNSHALLOW(X,type)                                            \
+    if (A->X ## _shallow && A->X != NULL)                               \
+    {                                                                   \
+        A ## X = GB_MALLOC (A->X ## _size, type, &A ## X ## _size) ;    \
+        if (A ## X == NULL)                                             \
+        {                                                               \
+            /* out of memory */                                         \
+            GB_FREE_ALL ;                                               \
+            return (GrB_OUT_OF_MEMORY) ;                                \
+        }                                                               \
+        GB_memcpy (A ## X, A->X, A->X ## _size, nthreads_max) ;         \
+    }
+
+GrB_Info GB_unshallow           // copy all shallow components of A
+(
+    GrB_Matrix A                // matrix to modify
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    if (A == NULL || !GB_is_shallow (A))
+    { 
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    GBURBLE ("(copy-on-write) ") ;
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    GB_void *Ap = NULL ; size_t Ap_size = 0 ;
+    GB_void *Ah = NULL ; size_t Ah_size = 0 ;
+    GB_void *Ab = NULL ; size_t Ab_size = 0 ;
+    GB_void *Ai = NULL ; size_t Ai_size = 0 ;
+    GB_void *Ax = NULL ; size_t Ax_size = 0 ;
+
+    //--------------------------------------------------------------------------
+    // copy each shallow component
+    //--------------------------------------------------------------------------
+
+    // All copies are made before A is modified, so A is unchanged if
+    // any allocation fails.
+
+    GB_UNSHALLOW (p, GB_void) ;
+    GB_UNSHALLOW (h, GB_void) ;
+    GB_UNSHALLOW (b, GB_void) ;
+    GB_UNSHALLOW (i, GB_void) ;
+    GB_UNSHALLOW (x, GB_void) ;
+
+    //--------------------------------------------------------------------------
+    // replace the shallow components with their copies
+    //--------------------------------------------------------------------------
+
+    #define GB_REPLACE(X)                                               \
+        if (A ## X != NULL)                                             \
+        {                                                               \
+            A->X = (void *) A ## X ;                                    \
+            A->X ## _size = A ## X ## _size ;                           \
+            A->X ## _shallow = false ;                                  \
+        }
+
+    GB_REPLACE (p) ;
+    GB_REPLACE (h) ;
+    GB_REPLACE (b) ;
+    GB_REPLACE (i) ;
+    GB_REPLACE (x) ;
+
+    if (A->Y_shallow || GB_is_shallow (A->Y))
+    { 
+        GB_hyper_hash_free (A) ;
+    }
+
+    ASSERT (!GB_is_shallow (A)) ;
+    return (GrB_SUCCESS) ;
+}
@@ -508,12 +508,82 @@ GrB_Info GB_wait                // finish all pending computations
         }
 
         // append the vectors of T to the end of A
-        for (int64_t k = 0 ; k < tnvec ; k++)
-        { 
-            int64_t j = Th [k] ;
-            ASSERT (j >= tjfirst) ;
-            anz += (Tp [k+1] - Tp [k]) ;
-            GB_OK (GB_jappend (A, j, &jlast, anz, &anz_last, Werk)) ;
+        if (T->nvec_nonempty == tnvec)
+        {
+
+            //------------------------------------------------------------------
+            // all vectors of T are non-empty: append them in parallel
+            //------------------------------------------------------------------
+
+            // This has the same effect as the GB_jappend loop below, except
+            // that the vectors of T are appended to A in parallel.  The
+            // hyperlist of A is reallocated just once, if needed.
+
+            int64_t *restrict Ap = A->p ;
+            nthreads = GB_nthreads (tnvec, chunk, nthreads_max) ;
+            int64_t k ;
+
+            if (A->h != NULL)
+            {
+                // A is hypersparse: append Th to Ah, and Tp (shifted) to Ap.
+                // Any vectors A(:,kA:end) are empty and are discarded.
+                int64_t anvec0 = kA ;
+                ASSERT (Ap [anvec0] == anz0) ;
+                if (anvec0 + tnvec > A->plen)
+                {
+                    GB_OK (GB_hyper_realloc (A,
+                        GB_IMIN (A->vdim, 2 * (anvec0 + tnvec)), Werk)) ;
+                    Ap = A->p ;
+                }
+                int64_t *restrict Ah = A->h ;
+                #pragma omp parallel for num_threads(nthreads) schedule(static)
+                for (k = 0 ; k < tnvec ; k++)
+                {
+                    Ah [anvec0 + k] = Th [k] ;
+                    Ap [anvec0 + k + 1] = anz0 + Tp [k+1] ;
+                }
+                A->nvec = anvec0 + tnvec ;
+            }
+            else
+            {
+                // A is sparse: each task logs the end of vector Th [k], and
+                // all empty vectors of A that precede it, in Ap.  The tasks
+                // modify disjoint parts of Ap.
+                ASSERT (Ap [jlast+1] == anz0) ;
+                #pragma omp parallel for num_threads(nthreads) \
+                    schedule(dynamic,1024)
+                for (k = 0 ; k < tnvec ; k++)
+                {
+                    int64_t j = Th [k] ;
+                    int64_t jprev = (k == 0) ? jlast : Th [k-1] ;
+                    ASSERT (j >= tjfirst && j > jprev) ;
+                    int64_t pstart = anz0 + Tp [k] ;
+                    for (int64_t jprior = jprev+1 ; jprior < j ; jprior++)
+                    {
+                        // mark the end of the empty vector A(:,jprior)
+                        Ap [jprior+1] = pstart ;
+                    }
+                    // mark the end of A(:,j)
+                    Ap [j+1] = anz0 + Tp [k+1] ;
+                }
+            }
+            jlast = Th [tnvec-1] ;
+            anz = anz0 + tnz ;
+        }
+        else
+        {
+
+            //------------------------------------------------------------------
+            // T may have empty vectors: append them one at a time
+            //------------------------------------------------------------------
+
+            for (int64_t k = 0 ; k < tnvec ; k++)
+            {
+                int64_t j = Th [k] ;
+                ASSERT (j >= tjfirst) ;
+                anz += (Tp [k+1] - Tp [k]) ;
+                GB_OK (GB_jappend (A, j, &jlast, anz, &anz_last, Werk)) ;
+            }
         }
 
         GB_jwrapup (A, jlast, anz) ;
@@ -39,6 +39,55 @@ GB_disable
 
 #include "GB_monoid_shared_definitions.h"
 
+m4_divert(if_red_has_avx)
+//------------------------------------------------------------------------------
+// panel reduction with AVX512F or AVX2
+//------------------------------------------------------------------------------
+
+// The panel reduction is compiled for AVX512F, AVX2, and for any
+// architecture.  The method is selected at run time, based on the CPU.
+
+#if !GB_DISABLE
+
+    #if GB_COMPILER_SUPPORTS_AVX512F
+
+        GB_TARGET_AVX512F static inline void GB_reduce_panel_avx512f
+        (
+            GB_Z_TYPE *result,
+            const GrB_Matrix A,
+            GB_Z_TYPE *restrict W,
+            int ntasks,
+            int nthreads
+        )
+        {
+            GB_Z_TYPE z = (*result) ;
+            #include "GB_reduce_panel.c"
+            (*result) = z ;
+        }
+
+    #endif
+
+    #if GB_COMPILER_SUPPORTS_AVX2
+
+        GB_TARGET_AVX2 static inline void GB_reduce_panel_avx2
+        (
+            GB_Z_TYPE *result,
+            const GrB_Matrix A,
+            GB_Z_TYPE *restrict W,
+            int ntasks,
+            int nthreads
+        )
+        {
+            GB_Z_TYPE z = (*result) ;
+            #include "GB_reduce_panel.c"
+            (*result) = z ;
+        }
+
+    #endif
+
+#endif
+
+m4_divert(0)
 //------------------------------------------------------------------------------
 // reduce to a non-iso matrix to scalar, for monoids only
 //------------------------------------------------------------------------------
@@ -64,6 +113,25 @@ GrB_Info GB (_red)
     }
     else
     {
+m4_divert(if_red_has_avx)m4_dnl
+        #if GB_COMPILER_SUPPORTS_AVX512F
+        if (GB_Global_cpu_features_avx512f ( ))
+        { 
+            // x86_64 with AVX512F
+            GB_reduce_panel_avx512f (result, A, W, ntasks, nthreads) ;
+            return (GrB_SUCCESS) ;
+        }
+        #endif
+        #if GB_COMPILER_SUPPORTS_AVX2
+        if (GB_Global_cpu_features_avx2 ( ))
+        { 
+            // x86_64 with AVX2
+            GB_reduce_panel_avx2 (result, A, W, ntasks, nthreads) ;
+            return (GrB_SUCCESS) ;
+        }
+        #endif
+        // any architecture
+m4_divert(0)m4_dnl
         #include "GB_reduce_panel.c"
     }
     (*result) = z ;
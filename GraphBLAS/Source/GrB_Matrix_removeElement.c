@@ -156,13 +156,19 @@ GrB_Info GB_Matrix_removeElement
 )
 {
 
+    //--------------------------------------------------------------------------
+    // copy-on-write, if C is shallow
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GB_OK (GB_unshallow (C)) ;
+
     //--------------------------------------------------------------------------
     // if C is jumbled, wait on the matrix first.  If full, convert to nonfull
     //--------------------------------------------------------------------------
 
     if (C->jumbled || GB_IS_FULL (C))
     {
-        GrB_Info info ;
         if (GB_IS_FULL (C))
         { 
             // convert C from full to sparse
@@ -239,7 +245,6 @@ GrB_Info GB_Matrix_removeElement
     // assemble any pending tuples; zombies are OK
     if (C_is_pending)
     { 
-        GrB_Info info ;
         GB_OK (GB_wait (C, "C (removeElement:pending tuples)", Werk)) ;
         ASSERT (!GB_ZOMBIES (C)) ;
         ASSERT (!GB_JUMBLED (C)) ;
@@ -53,6 +53,8 @@ GrB_Info GrB_transpose              // C<M> = accum(C,A') or accum(C,A)
     // get the mask
     GrB_Matrix M = GB_get_mask (M_in, &Mask_comp, &Mask_struct) ;
 
+    GB_OK (GB_unshallow (C)) ;         // copy-on-write, if C is shallow
+
     // check domains and dimensions for C<M> = accum (C,T)
     GB_OK (GB_compatible (C->type, C, M, Mask_struct, accum, A->type, Werk));
 
@@ -96,6 +96,52 @@ GrB_Info GxB_Context_get_FP64       // get a parameter in a Context
     return (GrB_SUCCESS) ;
 }
 
+//------------------------------------------------------------------------------
+// GxB_Context_get_FUNCTION: get a Context option (function pointer)
+//------------------------------------------------------------------------------
+
+GrB_Info GxB_Context_get_FUNCTION   // get a parameter in a Context
+(
+    GxB_Context Context,            // Context to query
+    GxB_Context_Field field,        // parameter to query
+    void **value                    // return value from the Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Context_get_FUNCTION (Context, field, &value)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (Context) ;
+    GB_RETURN_IF_NULL (value) ;
+
+    //--------------------------------------------------------------------------
+    // get the parameter
+    //--------------------------------------------------------------------------
+
+    switch (field)
+    {
+
+        case GxB_CONTEXT_TRACE : 
+
+            (*value) = (void *) GB_Context_trace_get (Context, NULL) ;
+            break ;
+
+        case GxB_CONTEXT_TRACE_COOKIE : 
+
+            GB_Context_trace_get (Context, value) ;
+            break ;
+
+        default : 
+
+            return (GrB_INVALID_VALUE) ;
+    }
+
+    #pragma omp flush
+    return (GrB_SUCCESS) ;
+}
+
 //------------------------------------------------------------------------------
 // GxB_Context_get: get a Context option (va_arg variant)
 //------------------------------------------------------------------------------
@@ -157,6 +203,28 @@ GrB_Info GxB_Context_get            // get a parameter in a Context
             }
             break ;
 
+        case GxB_CONTEXT_TRACE : 
+
+            {
+                va_start (ap, field) ;
+                void **value = va_arg (ap, void **) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (value) ;
+                (*value) = (void *) GB_Context_trace_get (Context, NULL) ;
+            }
+            break ;
+
+        case GxB_CONTEXT_TRACE_COOKIE : 
+
+            {
+                va_start (ap, field) ;
+                void **value = va_arg (ap, void **) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (value) ;
+                GB_Context_trace_get (Context, value) ;
+            }
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -92,6 +92,50 @@ GrB_Info GxB_Context_set_FP64       // set a parameter in a Context
     return (GrB_SUCCESS) ;
 }
 
+//------------------------------------------------------------------------------
+// GxB_Context_set_FUNCTION: set a Context option (function pointer)
+//------------------------------------------------------------------------------
+
+GrB_Info GxB_Context_set_FUNCTION   // set a parameter in a Context
+(
+    GxB_Context Context,            // Context to modify
+    GxB_Context_Field field,        // parameter to change
+    void *value                     // value to change it to
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Context_set_FUNCTION (Context, field, value)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (Context) ;
+
+    //--------------------------------------------------------------------------
+    // set the parameter
+    //--------------------------------------------------------------------------
+
+    switch (field)
+    {
+
+        case GxB_CONTEXT_TRACE : 
+
+            GB_Context_trace_set (Context, (GxB_trace_function) value) ;
+            break ;
+
+        case GxB_CONTEXT_TRACE_COOKIE : 
+
+            GB_Context_trace_cookie_set (Context, value) ;
+            break ;
+
+        default : 
+
+            return (GrB_INVALID_VALUE) ;
+    }
+
+    return (GrB_SUCCESS) ;
+}
+
 //------------------------------------------------------------------------------
 // GxB_Context_set: based on va_arg
 //------------------------------------------------------------------------------
@@ -150,6 +194,26 @@ GrB_Info GxB_Context_set            // set a parameter in a Context
             }
             break ;
 
+        case GxB_CONTEXT_TRACE : 
+
+            {
+                va_start (ap, field) ;
+                GxB_trace_function value = va_arg (ap, GxB_trace_function) ;
+                GB_Context_trace_set (Context, value) ;
+                va_end (ap) ;
+            }
+            break ;
+
+        case GxB_CONTEXT_TRACE_COOKIE : 
+
+            {
+                va_start (ap, field) ;
+                void *value = va_arg (ap, void *) ;
+                GB_Context_trace_cookie_set (Context, value) ;
+                va_end (ap) ;
+            }
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
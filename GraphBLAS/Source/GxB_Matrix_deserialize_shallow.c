@@ -0,0 +1,64 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_deserialize_shallow: create a matrix that shares a blob
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// deserialize: create a GrB_Matrix from a blob of bytes, without copying it
+
+// Identical to GxB_Matrix_deserialize, except that the components of the blob
+// that are not compressed (blobs created with the GxB_COMPRESSION_NONE method)
+// are not copied.  Instead, the matrix C points directly into the blob.  This
+// allows a very large matrix held in a file to be used without reading it
+// into memory, by mapping the file into memory with mmap (read-only) and then
+// passing the mapped region to this method as the blob.  Many processes can
+// then share a single copy of the matrix via the page cache of the OS.
+
+// The blob must not be modified or freed (or unmapped) while C exists.  C
+// may be used as an input to any GraphBLAS method.  If C is modified, it
+// first makes a private copy of all of its shallow components (copy-on-write),
+// and after that C no longer depends on the blob.  GrB_Matrix_free does not
+// free or modify the blob.
+
+#include "GB.h"
+#include "GB_serialize.h"
+
+GrB_Info GxB_Matrix_deserialize_shallow // deserialize blob, without copying it
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the blob
+    // input:
+    GrB_Type type,      // type of the matrix C.  Required if the blob holds a
+                        // matrix of user-defined type.  May be NULL if blob
+                        // holds a built-in type; otherwise must match the
+                        // type of C.
+    const void *blob,       // the blob, which must not be modified or freed
+                            // while C exists
+    GrB_Index blob_size,    // size of the blob
+    const GrB_Descriptor desc       // to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_deserialize_shallow (&C, type, blob, blob_size, "
+        "desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_deserialize_shallow") ;
+    GB_RETURN_IF_NULL (blob) ;
+    GB_RETURN_IF_NULL (C) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    //--------------------------------------------------------------------------
+    // deserialize the blob into a matrix, with shallow components
+    //--------------------------------------------------------------------------
+
+    info = GB_deserialize (C, type, (const GB_void *) blob,
+        (size_t) blob_size, true) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
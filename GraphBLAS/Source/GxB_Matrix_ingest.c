@@ -0,0 +1,48 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_ingest: merge matrices filled by several user threads into C
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_ingest.h"
+
+GrB_Info GxB_Matrix_ingest          // merge an array of matrices into C
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_BinaryOp dup,         // operator for duplicates, or NULL
+    GrB_Matrix *Pieces,             // array of size npieces; cleared on output
+    const GrB_Index npieces,
+    const GrB_Descriptor desc       // unused, except threading control
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (C, "GxB_Matrix_ingest (C, dup, Pieces, npieces, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_ingest") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;
+    GB_RETURN_IF_FAULTY_OR_POSITIONAL (dup) ;
+    GB_RETURN_IF_NULL (Pieces) ;
+    if (npieces <= 0 || npieces > GB_NMAX)
+    { 
+        GB_ERROR (GrB_INVALID_VALUE, "npieces (" GBu ") must be > 0",
+            npieces) ;
+    }
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    //--------------------------------------------------------------------------
+    // C = dup (C, Pieces{:})
+    //--------------------------------------------------------------------------
+
+    info = GB_ingest (C, dup, Pieces, (int64_t) npieces, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
@@ -0,0 +1,61 @@
+//------------------------------------------------------------------------------
+// GxB_mxv_batch: batch of matrix-vector multiplies with a shared matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// w{k}<M{k}> = accum (w{k},t) where t = A*u{k} or A'*u{k}, for all k in the
+// range 0 to nbatch-1.  The result is the same as nbatch calls to GrB_mxv, all
+// with the same accum, semiring, A, and desc, but A is traversed just once for
+// the whole batch.  See GB_mxv_batch for details.
+
+#include "GB_mxm.h"
+
+GrB_Info GxB_mxv_batch              // w{k}<M{k}> = accum (w{k}, A*u{k})
+(
+    GrB_Vector *w,                  // array of input/output vectors
+    const GrB_Vector *Mask,         // optional array of masks, may be NULL
+    const GrB_BinaryOp accum,       // optional accum for z=accum(w,t)
+    const GrB_Semiring semiring,    // defines '+' and '*' for matrix multiply
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Vector *u,            // array of second inputs: vectors u{k}
+    const GrB_Index nbatch,         // # of vectors in w, Mask, and u
+    const GrB_Descriptor desc       // descriptor for w, M, and A
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_RETURN_IF_NULL (w) ;
+    GB_WHERE ((nbatch > 0 ? w [0] : NULL),
+        "GxB_mxv_batch (w, M, accum, semiring, A, u, nbatch, desc)") ;
+    GB_BURBLE_START ("GxB_mxv_batch") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,
+        A_transpose, xx, AxB_method, do_sort) ;
+
+    //--------------------------------------------------------------------------
+    // w{k}<M{k}> = accum (w{k},A*u{k}) and variations, for all k
+    //--------------------------------------------------------------------------
+
+    info = GB_mxv_batch (
+        w, Mask, (int64_t) nbatch,          // the batch of vectors
+        C_replace, Mask_comp, Mask_struct,  // descriptor for w and the mask
+        accum,                              // for accum (w,t)
+        semiring,                           // definition of matrix multiply
+        A,                  A_transpose,    // allow A to be transposed
+        u,                                  // u is never transposed
+        false,                              // fmult(x,y), flipxy = false
+        AxB_method, do_sort,                // algorithm selector
+        Werk) ;
+
+    GB_BURBLE_END ;
+    return (info) ;
+}
@@ -57,7 +57,8 @@ ztype_is_real = ~codegen_contains (ztype, 'FC') ;
 ztype_is_fp = isequal (ztype, 'float') || isequal (ztype, 'double') ;
 is_any_complex = is_any && ~ztype_is_real ;
 is_plus_pair_real = is_plus && is_pair && (is_integer || ztype_is_fp) ;
-is_plus_times_fp = is_plus && isequal (multop, 'times') && ztype_is_fp ;
+ztype_is_64bit_int = isequal (ztype, 'int64_t') || isequal (ztype, 'uint64_t') ;
+is_plus_times_avx = is_plus && isequal (multop, 'times') && (ztype_is_fp || ztype_is_64bit_int) ;
 
 t_is_simple = is_pair || codegen_contains (multop, 'first') || codegen_contains (multop, 'second') ;
 t_is_nonnan = isequal (multop (1:2), 'is') || (multop (1) == 'l') ;
@@ -294,10 +295,10 @@ else
     fprintf (f, 'm4_define(`GB_is_any_pair_semiring'', `'')\n') ;
 end
 
-if (is_plus_times_fp)
-    % enable the avx-based methods.  only two semirings (plus_times_fp32 and
-    % plus_times_fp64) are accelerated with AVX2 or AVX512f instructions.  More
-    % semirings will be accelerated in the future.
+if (is_plus_times_avx)
+    % enable the avx-based methods.  only the plus_times semirings for fp32,
+    % fp64, int64, and uint64 are accelerated with AVX2 or AVX512f
+    % instructions.  More semirings will be accelerated in the future.
     fprintf (f, 'm4_define(`if_semiring_has_avx'', `0'')\n') ;
     fprintf (f, 'm4_define(`GB_semiring_has_avx'', `#define GB_SEMIRING_HAS_AVX_IMPLEMENTATION 1'')\n') ;
 else
@@ -754,8 +755,11 @@ if (is_any_pair)
     % fprintf (f, 'm4_define(`GB_multiply_add'', `'')\n') ;
 elseif (~is_imin_or_imax && ...
     (isequal (ztype, 'float') || isequal (ztype, 'double') || ...
-     isequal (ztype, 'bool') || is_first || is_second || is_pair || is_positional))
+     isequal (ztype, 'bool') || is_first || is_second || is_pair || ...
+     is_positional || is_plus_times_avx))
     % float and double do not get promoted.
+    % int64 and uint64 do not get promoted, and plus_times on these types
+    % must use a fused multiply-add for the avx-based saxpy5 method.
     % bool is OK since promotion of the result (0 or 1) to int is safe.
     % first and second are OK since no promotion occurs.
     % positional operators are OK too.
@@ -105,6 +105,16 @@ else
     fprintf (f, 'm4_define(`GB_panel'', `#define GB_PANEL %d'')\n', panel) ;
 end
 
+% enable the AVX2 and AVX512F panel reductions.  Only the PLUS monoid for
+% float, double, and int64_t is accelerated in the FactoryKernels.
+if (isequal (opname, 'plus') && ...
+    (isequal (atype, 'float') || isequal (atype, 'double') || ...
+     isequal (atype, 'int64_t')))
+    fprintf (f, 'm4_define(`if_red_has_avx'', `0'')\n') ;
+else
+    fprintf (f, 'm4_define(`if_red_has_avx'', `-1'')\n') ;
+end
+
 % create the update operator
 update_op = op {1} ;
 update_op = strrep (update_op, 'zarg', 'z') ;
@@ -0,0 +1,257 @@
+//------------------------------------------------------------------------------
+// GB_mex_test26: test GxB_vxm_batch and GxB_mxv_batch
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test26"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define NBATCH 6
+#define N 40
+
+// return true if the two vectors are identical
+static bool vector_equal (GrB_Vector u, GrB_Vector v)
+{
+    GrB_Info info ;
+    GrB_Index unvals, vnvals, n ;
+    OK (GrB_Vector_nvals (&unvals, u)) ;
+    OK (GrB_Vector_nvals (&vnvals, v)) ;
+    if (unvals != vnvals) return (false) ;
+    OK (GrB_Vector_size (&n, u)) ;
+    GrB_Vector t ;
+    OK (GrB_Vector_new (&t, GrB_BOOL, n)) ;
+    OK (GrB_eWiseMult (t, NULL, NULL, GrB_EQ_FP64, u, v, NULL)) ;
+    GrB_Index tnvals ;
+    bool all_equal = true ;
+    OK (GrB_Vector_nvals (&tnvals, t)) ;
+    OK (GrB_reduce (&all_equal, NULL, GrB_LAND_MONOID_BOOL, t, NULL)) ;
+    OK (GrB_Vector_free (&t)) ;
+    return (tnvals == unvals && all_equal) ;
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+
+    //--------------------------------------------------------------------------
+    // create the test problem
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix A ;
+    GrB_Vector W [NBATCH], W2 [NBATCH], U [NBATCH], M [NBATCH] ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, N, N)) ;
+    simple_rand_seed (1) ;
+    for (int k = 0 ; k < 4*N ; k++)
+    {
+        GrB_Index i = simple_rand ( ) % N ;
+        GrB_Index j = simple_rand ( ) % N ;
+        double x = (double) (simple_rand ( ) % 100) ;
+        OK (GrB_Matrix_setElement_FP64 (A, x, i, j)) ;
+    }
+
+    for (int k = 0 ; k < NBATCH ; k++)
+    {
+        OK (GrB_Vector_new (&(U [k]), GrB_FP64, N)) ;
+        OK (GrB_Vector_new (&(M [k]), GrB_BOOL, N)) ;
+        OK (GrB_Vector_new (&(W [k]), GrB_FP64, N)) ;
+        for (int t = 0 ; t <= k ; t++)
+        {
+            // a small frontier for U{k}
+            GrB_Index i = simple_rand ( ) % N ;
+            OK (GrB_Vector_setElement_FP64 (U [k], (double) (t+1), i)) ;
+        }
+        for (int t = 0 ; t < N/2 ; t++)
+        {
+            // a valued mask, with some explicit false entries
+            GrB_Index i = simple_rand ( ) % N ;
+            OK (GrB_Vector_setElement_BOOL (M [k], (t % 3) != 0, i)) ;
+            // a starting value for W{k}
+            i = simple_rand ( ) % N ;
+            OK (GrB_Vector_setElement_FP64 (W [k], (double) t, i)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // compare the batch methods with GrB_vxm and GrB_mxv
+    //--------------------------------------------------------------------------
+
+    GrB_Descriptor descs [4] = { NULL, GrB_DESC_RC, GrB_DESC_T0, GrB_DESC_S } ;
+    for (int trial = 0 ; trial < 16 ; trial++)
+    {
+        GrB_Descriptor desc = descs [trial % 4] ;
+        bool use_mask = (trial % 8) < 4 ;
+        bool use_accum = (trial % 16) < 8 ;
+        GrB_BinaryOp accum = use_accum ? GrB_PLUS_FP64 : NULL ;
+        GrB_Vector *Mask = use_mask ? M : NULL ;
+
+        // vxm
+        for (int k = 0 ; k < NBATCH ; k++)
+        {
+            OK (GrB_Vector_dup (&(W2 [k]), W [k])) ;
+            OK (GrB_vxm (W [k], use_mask ? M [k] : NULL, accum,
+                GrB_MIN_PLUS_SEMIRING_FP64, U [k], A, desc)) ;
+        }
+        OK (GxB_vxm_batch (W2, Mask, accum, GrB_MIN_PLUS_SEMIRING_FP64, U, A,
+            NBATCH, desc)) ;
+        for (int k = 0 ; k < NBATCH ; k++)
+        {
+            CHECK (vector_equal (W [k], W2 [k])) ;
+            OK (GrB_Vector_free (&(W2 [k]))) ;
+        }
+
+        // mxv
+        for (int k = 0 ; k < NBATCH ; k++)
+        {
+            OK (GrB_Vector_dup (&(W2 [k]), W [k])) ;
+            OK (GrB_mxv (W [k], use_mask ? M [k] : NULL, accum,
+                GrB_PLUS_TIMES_SEMIRING_FP64, A, U [k], desc)) ;
+        }
+        OK (GxB_mxv_batch (W2, Mask, accum, GrB_PLUS_TIMES_SEMIRING_FP64, A,
+            U, NBATCH, desc)) ;
+        for (int k = 0 ; k < NBATCH ; k++)
+        {
+            CHECK (vector_equal (W [k], W2 [k])) ;
+            OK (GrB_Vector_free (&(W2 [k]))) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // W{k} aliased with U{k}
+    //--------------------------------------------------------------------------
+
+    for (int k = 0 ; k < NBATCH ; k++)
+    {
+        OK (GrB_Vector_dup (&(W2 [k]), U [k])) ;
+        OK (GrB_vxm (W [k], NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, U [k],
+            A, NULL)) ;
+    }
+    OK (GxB_vxm_batch (W2, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, W2, A,
+        NBATCH, NULL)) ;
+    for (int k = 0 ; k < NBATCH ; k++)
+    {
+        CHECK (vector_equal (W [k], W2 [k])) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // out of memory: W{:} must be left unchanged
+    //--------------------------------------------------------------------------
+
+    GrB_Vector Wsave [NBATCH] ;
+    for (int k = 0 ; k < NBATCH ; k++)
+    {
+        OK (GrB_Vector_free (&(W2 [k]))) ;
+        OK (GrB_Vector_dup (&(W2 [k]), W [k])) ;
+        OK (GrB_Vector_dup (&(Wsave [k]), W [k])) ;
+        OK (GrB_mxv (W [k], M [k], GrB_PLUS_FP64, GrB_PLUS_TIMES_SEMIRING_FP64,
+            A, U [k], NULL)) ;
+        // make W2{k} sparse, so that it must be conformed on output
+        OK (GxB_Vector_Option_set (W2 [k], GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    }
+
+    int nmalloc_start = (int) GB_Global_nmalloc_get ( ) ;
+    for (int tries = 0 ; ; tries++)
+    {
+        // allow GraphBLAS to do just tries mallocs, and then fail
+        GB_Global_malloc_debug_count_set (tries) ;
+        GB_Global_malloc_debug_set (true) ;
+        info = GxB_mxv_batch (W2, M, GrB_PLUS_FP64,
+            GrB_PLUS_TIMES_SEMIRING_FP64, A, U, NBATCH, NULL) ;
+        GB_Global_malloc_debug_set (false) ;
+        if (info == GrB_SUCCESS) break ;
+        CHECK (info == GrB_OUT_OF_MEMORY) ;
+        CHECK (tries < 100000) ;
+        // no output vector has been modified, and nothing has leaked
+        for (int k = 0 ; k < NBATCH ; k++)
+        {
+            CHECK (vector_equal (W2 [k], Wsave [k])) ;
+        }
+        CHECK ((int) GB_Global_nmalloc_get ( ) == nmalloc_start) ;
+    }
+    for (int k = 0 ; k < NBATCH ; k++)
+    {
+        CHECK (vector_equal (W [k], W2 [k])) ;
+        OK (GrB_Vector_free (&(Wsave [k]))) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    GrB_Vector Mask_partial [NBATCH] ;
+    for (int k = 0 ; k < NBATCH ; k++)
+    {
+        Mask_partial [k] = (k == NBATCH-1) ? NULL : M [k] ;
+    }
+
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_vxm_batch (NULL, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, U, A,
+        NBATCH, NULL)) ;
+    ERR (GxB_mxv_batch (W2, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A,
+        NULL, NBATCH, NULL)) ;
+
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_vxm_batch (W2, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, U, A,
+        0, NULL)) ;
+    ERR (GxB_vxm_batch (W2, Mask_partial, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+        U, A, NBATCH, NULL)) ;
+
+    expected = GrB_DOMAIN_MISMATCH ;
+    GrB_Vector Wbool [2] ;
+    OK (GrB_Vector_new (&(Wbool [0]), GrB_FP64, N)) ;
+    OK (GrB_Vector_new (&(Wbool [1]), GrB_BOOL, N)) ;
+    ERR (GxB_vxm_batch (Wbool, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, U, A,
+        2, NULL)) ;
+    OK (GrB_Vector_free (&(Wbool [0]))) ;
+    OK (GrB_Vector_free (&(Wbool [1]))) ;
+
+    expected = GrB_DIMENSION_MISMATCH ;
+    GrB_Vector Wshort [2] ;
+    OK (GrB_Vector_new (&(Wshort [0]), GrB_FP64, N)) ;
+    OK (GrB_Vector_new (&(Wshort [1]), GrB_FP64, N-1)) ;
+    ERR (GxB_vxm_batch (Wshort, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, U, A,
+        2, NULL)) ;
+    OK (GrB_Vector_free (&(Wshort [0]))) ;
+    OK (GrB_Vector_free (&(Wshort [1]))) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_free (&A)) ;
+    for (int k = 0 ; k < NBATCH ; k++)
+    {
+        OK (GrB_Vector_free (&(W [k]))) ;
+        OK (GrB_Vector_free (&(W2 [k]))) ;
+        OK (GrB_Vector_free (&(U [k]))) ;
+        OK (GrB_Vector_free (&(M [k]))) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test26:  all tests passed\n\n") ;
+}
@@ -0,0 +1,182 @@
+//------------------------------------------------------------------------------
+// GB_mex_test27: test GxB_Matrix_serialize_stream and deserialize_stream
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test27"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+// an in-memory stream, standing in for a file descriptor
+typedef struct
+{
+    uint8_t *buffer ;
+    size_t size ;
+    size_t capacity ;
+    bool fail ;
+}
+stream_struct ;
+
+static int stream_write (void *cookie, const void *buffer, size_t size,
+    uint64_t offset)
+{
+    stream_struct *S = (stream_struct *) cookie ;
+    if (S->fail || offset + size > S->capacity) return (-1) ;
+    memcpy (S->buffer + offset, buffer, size) ;
+    S->size = GB_IMAX (S->size, offset + size) ;
+    return (0) ;
+}
+
+static int stream_read (void *cookie, void *buffer, size_t size,
+    uint64_t offset)
+{
+    stream_struct *S = (stream_struct *) cookie ;
+    if (S->fail || offset + size > S->size) return (-1) ;
+    memcpy (buffer, S->buffer + offset, size) ;
+    return (0) ;
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, C = NULL ;
+    GrB_Descriptor desc = NULL ;
+    stream_struct S ;
+    S.capacity = 8 * 1024 * 1024 ;
+    S.buffer = mxMalloc (S.capacity) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+
+    //--------------------------------------------------------------------------
+    // serialize and deserialize matrices of each sparsity and compression
+    //--------------------------------------------------------------------------
+
+    int methods [5] = { GxB_COMPRESSION_NONE, GxB_COMPRESSION_DEFAULT,
+        GxB_COMPRESSION_LZ4, GxB_COMPRESSION_LZ4HC, GxB_COMPRESSION_ZSTD } ;
+    int sparsities [4] = { GxB_HYPERSPARSE, GxB_SPARSE, GxB_BITMAP, GxB_FULL } ;
+
+    simple_rand_seed (1) ;
+    for (int n = 10 ; n <= 1000 ; n *= 10)
+    {
+        OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+        for (int k = 0 ; k < 20*n ; k++)
+        {
+            GrB_Index i = simple_rand ( ) % n ;
+            GrB_Index j = simple_rand ( ) % n ;
+            double x = (double) (simple_rand ( ) % 100) ;
+            OK (GrB_Matrix_setElement_FP64 (A, x, i, j)) ;
+        }
+        for (int s = 0 ; s < 4 ; s++)
+        {
+            OK (GxB_set (A, GxB_SPARSITY_CONTROL, sparsities [s])) ;
+            if (sparsities [s] == GxB_FULL)
+            {
+                OK (GrB_assign (A, NULL, NULL, (double) 1, GrB_ALL, n,
+                    GrB_ALL, n, NULL)) ;
+            }
+            for (int m = 0 ; m < 5 ; m++)
+            {
+                OK (GxB_set (desc, GxB_COMPRESSION, methods [m])) ;
+
+                // write A to the stream
+                S.size = 0 ;
+                S.fail = false ;
+                GrB_Index blob_size = 0 ;
+                OK (GxB_Matrix_serialize_stream (&blob_size, stream_write, &S,
+                    A, desc)) ;
+                CHECK (blob_size == S.size) ;
+
+                // read the stream back in
+                OK (GxB_Matrix_deserialize_stream (&B, NULL, stream_read, &S,
+                    NULL)) ;
+                CHECK (GB_mx_isequal (A, B, 0)) ;
+                OK (GrB_Matrix_free (&B)) ;
+
+                // the stream is a valid blob
+                OK (GxB_Matrix_deserialize (&C, GrB_FP64, S.buffer, S.size,
+                    NULL)) ;
+                CHECK (GB_mx_isequal (A, C, 0)) ;
+                OK (GrB_Matrix_free (&C)) ;
+
+                // a blob can be read as a stream
+                void *blob = NULL ;
+                OK (GxB_Matrix_serialize (&blob, &blob_size, A, desc)) ;
+                memcpy (S.buffer, blob, blob_size) ;
+                S.size = blob_size ;
+                mxFree (blob) ;
+                OK (GxB_Matrix_deserialize_stream (&B, GrB_FP64, stream_read,
+                    &S, NULL)) ;
+                CHECK (GB_mx_isequal (A, B, 0)) ;
+                OK (GrB_Matrix_free (&B)) ;
+            }
+        }
+        OK (GrB_Matrix_free (&A)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, 100, 100)) ;
+    OK (GrB_Matrix_setElement_FP64 (A, 1, 2, 3)) ;
+    GrB_Index blob_size = 0 ;
+    S.size = 0 ;
+    S.fail = false ;
+    OK (GxB_Matrix_serialize_stream (&blob_size, stream_write, &S, A, NULL)) ;
+
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Matrix_serialize_stream (NULL, stream_write, &S, A, NULL)) ;
+    ERR (GxB_Matrix_serialize_stream (&blob_size, NULL, &S, A, NULL)) ;
+    ERR (GxB_Matrix_deserialize_stream (NULL, NULL, stream_read, &S, NULL)) ;
+    ERR (GxB_Matrix_deserialize_stream (&B, NULL, NULL, &S, NULL)) ;
+
+    expected = GrB_DOMAIN_MISMATCH ;
+    ERR (GxB_Matrix_deserialize_stream (&B, GrB_INT32, stream_read, &S,
+        NULL)) ;
+
+    expected = GrB_INVALID_OBJECT ;
+    uint64_t bad_size = 32 ;
+    memcpy (S.buffer, &bad_size, sizeof (uint64_t)) ;
+    ERR (GxB_Matrix_deserialize_stream (&B, NULL, stream_read, &S, NULL)) ;
+
+    expected = GrB_INVALID_VALUE ;
+    S.fail = true ;
+    ERR (GxB_Matrix_serialize_stream (&blob_size, stream_write, &S, A, NULL)) ;
+    ERR (GxB_Matrix_deserialize_stream (&B, NULL, stream_read, &S, NULL)) ;
+    CHECK (B == NULL) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_free (&A)) ;
+    OK (GrB_Descriptor_free (&desc)) ;
+    mxFree (S.buffer) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test27:  all tests passed\n\n") ;
+}
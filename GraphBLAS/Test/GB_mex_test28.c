@@ -0,0 +1,162 @@
+//------------------------------------------------------------------------------
+// GB_mex_test28: test GxB_Matrix_deserialize_shallow
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test28"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, C = NULL, T = NULL ;
+    GrB_Descriptor desc = NULL ;
+    OK (GrB_Descriptor_new (&desc)) ;
+
+    int methods [2] = { GxB_COMPRESSION_NONE, GxB_COMPRESSION_LZ4 } ;
+    int sparsities [4] = { GxB_HYPERSPARSE, GxB_SPARSE, GxB_BITMAP, GxB_FULL } ;
+
+    //--------------------------------------------------------------------------
+    // deserialize a shallow matrix, use it, and then modify it
+    //--------------------------------------------------------------------------
+
+    simple_rand_seed (1) ;
+    int n = 100 ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    for (int k = 0 ; k < 10*n ; k++)
+    {
+        GrB_Index i = simple_rand ( ) % n ;
+        GrB_Index j = simple_rand ( ) % n ;
+        double x = (double) (simple_rand ( ) % 100) ;
+        OK (GrB_Matrix_setElement_FP64 (A, x, i, j)) ;
+    }
+
+    for (int s = 0 ; s < 4 ; s++)
+    {
+        OK (GxB_set (A, GxB_SPARSITY_CONTROL, sparsities [s])) ;
+        if (sparsities [s] == GxB_FULL)
+        {
+            OK (GrB_assign (A, NULL, NULL, (double) 1, GrB_ALL, n,
+                GrB_ALL, n, NULL)) ;
+        }
+        for (int m = 0 ; m < 2 ; m++)
+        {
+            bool compressed = (methods [m] != GxB_COMPRESSION_NONE) ;
+            OK (GxB_set (desc, GxB_COMPRESSION, methods [m])) ;
+            void *blob = NULL, *blob_copy = NULL ;
+            GrB_Index blob_size = 0 ;
+            OK (GxB_Matrix_serialize (&blob, &blob_size, A, desc)) ;
+            blob_copy = mxMalloc (blob_size) ;
+            memcpy (blob_copy, blob, blob_size) ;
+
+            // C refers to the blob, except for its compressed components
+            OK (GxB_Matrix_deserialize_shallow (&C, NULL, blob, blob_size,
+                NULL)) ;
+            CHECK (GB_mx_isequal (A, C, 0)) ;
+            if (!compressed)
+            {
+                CHECK (GB_is_shallow (C)) ;
+                CHECK (C->x_shallow) ;
+                CHECK ((void *) C->x >= blob) ;
+                CHECK ((GB_void *) C->x < ((GB_void *) blob) + blob_size) ;
+            }
+
+            // C can be used as an input
+            OK (GrB_Matrix_new (&T, GrB_FP64, n, n)) ;
+            OK (GrB_mxm (T, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, C, C,
+                NULL)) ;
+            OK (GrB_Matrix_new (&B, GrB_FP64, n, n)) ;
+            OK (GrB_mxm (B, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A,
+                NULL)) ;
+            CHECK (GB_mx_isequal (T, B, 0)) ;
+            OK (GrB_Matrix_free (&T)) ;
+            OK (GrB_Matrix_free (&B)) ;
+
+            // modifying C copies it first, and leaves the blob unchanged
+            OK (GrB_Matrix_setElement_FP64 (C, 42, 3, 4)) ;
+            OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+            CHECK (!GB_is_shallow (C)) ;
+            CHECK (memcmp (blob, blob_copy, blob_size) == 0) ;
+            double x = 0 ;
+            OK (GrB_Matrix_extractElement_FP64 (&x, C, 3, 4)) ;
+            CHECK (x == 42) ;
+            OK (GrB_Matrix_free (&C)) ;
+
+            // C as the output of an operation
+            OK (GxB_Matrix_deserialize_shallow (&C, GrB_FP64, blob, blob_size,
+                NULL)) ;
+            OK (GrB_apply (C, NULL, NULL, GrB_AINV_FP64, C, NULL)) ;
+            CHECK (!GB_is_shallow (C)) ;
+            CHECK (memcmp (blob, blob_copy, blob_size) == 0) ;
+            OK (GrB_Matrix_free (&C)) ;
+
+            // C can be freed before the blob, and C can be removed from
+            OK (GxB_Matrix_deserialize_shallow (&C, GrB_FP64, blob, blob_size,
+                NULL)) ;
+            OK (GrB_Matrix_removeElement (C, 3, 4)) ;
+            CHECK (memcmp (blob, blob_copy, blob_size) == 0) ;
+            OK (GrB_Matrix_free (&C)) ;
+
+            mxFree (blob) ;
+            mxFree (blob_copy) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    void *blob = NULL ;
+    GrB_Index blob_size = 0 ;
+    OK (GxB_set (desc, GxB_COMPRESSION, GxB_COMPRESSION_NONE)) ;
+    OK (GxB_Matrix_serialize (&blob, &blob_size, A, desc)) ;
+
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Matrix_deserialize_shallow (NULL, NULL, blob, blob_size, NULL)) ;
+    ERR (GxB_Matrix_deserialize_shallow (&C, NULL, NULL, blob_size, NULL)) ;
+
+    expected = GrB_DOMAIN_MISMATCH ;
+    ERR (GxB_Matrix_deserialize_shallow (&C, GrB_INT32, blob, blob_size,
+        NULL)) ;
+
+    expected = GrB_INVALID_OBJECT ;
+    ERR (GxB_Matrix_deserialize_shallow (&C, NULL, blob, 32, NULL)) ;
+    CHECK (C == NULL) ;
+    mxFree (blob) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_free (&A)) ;
+    OK (GrB_Descriptor_free (&desc)) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test28:  all tests passed\n\n") ;
+}
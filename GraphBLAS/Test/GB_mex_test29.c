@@ -0,0 +1,271 @@
+//------------------------------------------------------------------------------
+// GB_mex_test29: test GB_wait (incremental append) and GxB_Matrix_ingest
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test29"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define N 1000
+#define NPIECES 5
+#define NMAX (4*N + NPIECES*N)
+
+// return true if the two matrices are identical
+static bool matrix_equal (GrB_Matrix A, GrB_Matrix B)
+{
+    GrB_Info info ;
+    GrB_Index anvals, bnvals, nrows, ncols ;
+    OK (GrB_Matrix_nvals (&anvals, A)) ;
+    OK (GrB_Matrix_nvals (&bnvals, B)) ;
+    if (anvals != bnvals) return (false) ;
+    OK (GrB_Matrix_nrows (&nrows, A)) ;
+    OK (GrB_Matrix_ncols (&ncols, A)) ;
+    GrB_Matrix T ;
+    OK (GrB_Matrix_new (&T, GrB_BOOL, nrows, ncols)) ;
+    OK (GrB_eWiseMult (T, NULL, NULL, GrB_EQ_FP64, A, B, NULL)) ;
+    GrB_Index tnvals ;
+    bool all_equal = true ;
+    OK (GrB_Matrix_nvals (&tnvals, T)) ;
+    OK (GrB_reduce (&all_equal, NULL, GrB_LAND_MONOID_BOOL, T, NULL)) ;
+    OK (GrB_Matrix_free (&T)) ;
+    return (tnvals == anvals && all_equal) ;
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C = NULL, Ref = NULL, Pieces [NPIECES] ;
+    GrB_Index *I = NULL, *J = NULL ;
+    double *X = NULL ;
+    I = mxMalloc (NMAX * sizeof (GrB_Index)) ;
+    J = mxMalloc (NMAX * sizeof (GrB_Index)) ;
+    X = mxMalloc (NMAX * sizeof (double)) ;
+
+    //--------------------------------------------------------------------------
+    // GB_wait: append new vectors to a sparse or hypersparse matrix
+    //--------------------------------------------------------------------------
+
+    // A(:,0:N/2) is created first, and then pending tuples are added to every
+    // third column after N/2, so that the assembled tuples T leave gaps in Ap.
+    // A second pass also adds a few entries to the last existing column of A,
+    // so that GB_wait must first merge A(:,kA:end) with T.
+
+    int sparsity [2] = { GxB_SPARSE, GxB_HYPERSPARSE } ;
+    for (int s = 0 ; s < 2 ; s++)
+    {
+        for (int pass = 0 ; pass < 2 ; pass++)
+        {
+            OK (GrB_Matrix_new (&A, GrB_FP64, N, N)) ;
+            OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, sparsity [s])) ;
+            int64_t nz = 0 ;
+            for (int64_t j = 0 ; j <= N/2 ; j++)
+            {
+                for (int64_t t = 0 ; t < 3 ; t++)
+                {
+                    I [nz] = (j + 7*t) % N ;
+                    J [nz] = j ;
+                    X [nz] = (double) (j + t) ;
+                    OK (GrB_Matrix_setElement_FP64 (A, X [nz], I [nz], J [nz]));
+                    nz++ ;
+                }
+            }
+            OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+            if (pass == 1)
+            {
+                // modify the last column of A, with one new entry and one
+                // that replaces an existing entry
+                I [nz] = 1 ; J [nz] = N/2 ; X [nz] = -1 ;
+                OK (GrB_Matrix_setElement_FP64 (A, X [nz], I [nz], J [nz])) ;
+                nz++ ;
+                I [nz] = N/2 ; J [nz] = N/2 ; X [nz] = -2 ;
+                OK (GrB_Matrix_setElement_FP64 (A, X [nz], I [nz], J [nz])) ;
+                nz++ ;
+            }
+            for (int64_t j = N/2 + 1 ; j < N ; j += 3)
+            {
+                // many setElements in descending row order for each column
+                for (int64_t t = 4 ; t >= 0 ; t--)
+                {
+                    I [nz] = (j * t) % N ;
+                    J [nz] = j ;
+                    X [nz] = (double) (j - t) ;
+                    OK (GrB_Matrix_setElement_FP64 (A, X [nz], I [nz], J [nz]));
+                    nz++ ;
+                }
+            }
+            OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+            CHECK (!GB_ANY_PENDING_WORK (A)) ;
+            OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL,
+                GxB_AUTO_SPARSITY)) ;
+
+            // compare with the same matrix created by GrB_Matrix_build
+            OK (GrB_Matrix_new (&Ref, GrB_FP64, N, N)) ;
+            OK (GrB_Matrix_build_FP64 (Ref, I, J, X, nz, GrB_SECOND_FP64)) ;
+            CHECK (matrix_equal (A, Ref)) ;
+            OK (GrB_Matrix_free (&A)) ;
+            OK (GrB_Matrix_free (&Ref)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // GxB_Matrix_ingest: merge pieces filled by several user threads
+    //--------------------------------------------------------------------------
+
+    for (int trial = 0 ; trial < 4 ; trial++)
+    {
+        bool use_plus = (trial % 2 == 0) ;
+        GrB_BinaryOp dup = use_plus ? GrB_PLUS_FP64 : NULL ;
+        int npieces = (trial < 2) ? NPIECES : 1 ;
+
+        // C starts with 4*N entries, with no duplicates
+        OK (GrB_Matrix_new (&C, GrB_FP64, N, N)) ;
+        int64_t nz = 0 ;
+        for (int64_t t = 0 ; t < 4*N ; t++)
+        {
+            I [nz] = t % N ;
+            J [nz] = ((t / N) * 251 + t) % N ;
+            X [nz] = (double) (t % 17) ;
+            OK (GrB_Matrix_setElement_FP64 (C, X [nz], I [nz], J [nz])) ;
+            nz++ ;
+        }
+        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+
+        // the reference is built from the tuples of C, with SECOND
+        OK (GrB_Matrix_new (&Ref, GrB_FP64, N, N)) ;
+        OK (GrB_Matrix_build_FP64 (Ref, I, J, X, nz, GrB_SECOND_FP64)) ;
+        CHECK (matrix_equal (C, Ref)) ;
+        OK (GrB_Matrix_free (&Ref)) ;
+
+        // each piece holds N entries, with unique (i,j) within each piece
+        for (int p = 0 ; p < npieces ; p++)
+        {
+            OK (GrB_Matrix_new (&(Pieces [p]), GrB_FP64, N, N)) ;
+            if (p == 1)
+            {
+                // one piece is held by row
+                OK (GxB_Matrix_Option_set (Pieces [p], GxB_FORMAT,
+                    GxB_BY_ROW)) ;
+            }
+        }
+
+        // fill the pieces in parallel, one thread per piece
+        int p ;
+        #pragma omp parallel for num_threads(npieces) schedule(static,1)
+        for (p = 0 ; p < npieces ; p++)
+        {
+            for (int64_t t = 0 ; t < N ; t++)
+            {
+                GrB_Index i = t ;
+                GrB_Index j = (t * (p+1) + 3*p) % N ;
+                double x = (double) (p + 1) ;
+                GrB_Matrix_setElement_FP64 (Pieces [p], x, i, j) ;
+                if (p == 2 && t == N/2)
+                {
+                    // this thread assembles its own tuples midway
+                    GrB_Matrix_wait (Pieces [p], GrB_MATERIALIZE) ;
+                }
+            }
+        }
+
+        // append the tuples of the pieces, in order
+        for (p = 0 ; p < npieces ; p++)
+        {
+            for (int64_t t = 0 ; t < N ; t++)
+            {
+                I [nz] = t ;
+                J [nz] = (t * (p+1) + 3*p) % N ;
+                X [nz] = (double) (p + 1) ;
+                nz++ ;
+            }
+        }
+
+        // C = dup (C, Pieces{:})
+        OK (GxB_Matrix_ingest (C, dup, Pieces, npieces, NULL)) ;
+        OK (GrB_Matrix_new (&Ref, GrB_FP64, N, N)) ;
+        OK (GrB_Matrix_build_FP64 (Ref, I, J, X, nz,
+            use_plus ? GrB_PLUS_FP64 : GrB_SECOND_FP64)) ;
+        CHECK (matrix_equal (C, Ref)) ;
+
+        // the pieces are cleared, and can be reused
+        for (p = 0 ; p < npieces ; p++)
+        {
+            GrB_Index nvals ;
+            OK (GrB_Matrix_nvals (&nvals, Pieces [p])) ;
+            CHECK (nvals == 0) ;
+            OK (GrB_Matrix_setElement_FP64 (Pieces [p], 1, 0, 0)) ;
+        }
+        OK (GxB_Matrix_ingest (C, GrB_PLUS_FP64, Pieces, npieces, NULL)) ;
+        double c00 = 0, r00 = 0 ;
+        OK (GrB_Matrix_extractElement_FP64 (&c00, C, 0, 0)) ;
+        OK (GrB_Matrix_extractElement_FP64 (&r00, Ref, 0, 0)) ;
+        CHECK (c00 == r00 + npieces) ;
+
+        OK (GrB_Matrix_free (&C)) ;
+        OK (GrB_Matrix_free (&Ref)) ;
+        for (p = 0 ; p < npieces ; p++)
+        {
+            OK (GrB_Matrix_free (&(Pieces [p]))) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&C, GrB_FP64, N, N)) ;
+    OK (GrB_Matrix_new (&(Pieces [0]), GrB_FP64, N, N)) ;
+    OK (GrB_Matrix_new (&(Pieces [1]), GrB_FP64, N, N-1)) ;
+
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Matrix_ingest (NULL, NULL, Pieces, 1, NULL)) ;
+    ERR (GxB_Matrix_ingest (C, NULL, NULL, 1, NULL)) ;
+
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_Matrix_ingest (C, NULL, Pieces, 0, NULL)) ;
+    GrB_Matrix Aliased [2] = { Pieces [0], Pieces [0] } ;
+    ERR (GxB_Matrix_ingest (C, NULL, Aliased, 2, NULL)) ;
+    ERR (GxB_Matrix_ingest (C, NULL, &C, 1, NULL)) ;
+
+    expected = GrB_DIMENSION_MISMATCH ;
+    ERR (GxB_Matrix_ingest (C, NULL, Pieces, 2, NULL)) ;
+
+    expected = GrB_DOMAIN_MISMATCH ;
+    ERR (GxB_Matrix_ingest (C, GrB_EQ_FP64, Pieces, 1, NULL)) ;
+
+    OK (GrB_Matrix_free (&C)) ;
+    OK (GrB_Matrix_free (&(Pieces [0]))) ;
+    OK (GrB_Matrix_free (&(Pieces [1]))) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    mxFree (I) ;
+    mxFree (J) ;
+    mxFree (X) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test29:  all tests passed\n\n") ;
+}
+
@@ -1,5 +1,5 @@
 function test240
-%TEST240 test GrB_mxm: dot4, saxpy4, saxpy5
+%TEST240 test GrB_mxm: dot4, saxpy4, saxpy5, and PLUS reductions
 
 % SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
 % SPDX-License-Identifier: Apache-2.0
@@ -63,6 +63,32 @@ for k = 1:32
     GB_spec_compare (C1, C2, 0, 1e-12) ;
 end
 
+% test saxpy5 with int64: A full, B sparse
+semiring.add.optype = 'int64' ;
+semiring.class = 'int64' ;
+A = GB_spec_random (n, n, 0.5, 100, 'int64', is_csc) ;
+A.sparsity = 2 ;    % A is sparse
+for k = [1 7 16 31]
+    % C += A*B
+    B = int64 (floor (100 * rand (k, n))) ;
+    F = int64 (floor (100 * rand (k, n))) ;
+    C1 = GB_mex_mxm_update (F, semiring, B, A, [ ]) ;
+    C2 = int64 (double (F) + double (B) * double (A.matrix)) ;
+    GB_spec_compare (C1, C2, 0, 0) ;
+end
+
+% test the PLUS reductions of a full matrix
+for n = [1 15 100 1000]
+    X = floor (100 * rand (n, 7)) ;
+    s = sum (X, 'all') ;
+    c = GB_mex_reduce_to_scalar (0, [ ], 'plus', X) ;
+    assert (abs (c - s) <= 1e-12 * s) ;
+    c = GB_mex_reduce_to_scalar (single (0), [ ], 'plus', single (X)) ;
+    assert (abs (double (c) - s) <= 1e-5 * s) ;
+    c = GB_mex_reduce_to_scalar (int64 (0), [ ], 'plus', int64 (X)) ;
+    assert (c == int64 (s)) ;
+end
+
 % GB_mex_burble (0) ;
 fprintf ('\ntest240: all tests passed\n') ;
 
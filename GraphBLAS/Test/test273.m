@@ -0,0 +1,8 @@
+function test273
+%TEST273 test GxB_vxm_batch and GxB_mxv_batch
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test26 ;
+fprintf ('test273 all tests passed.\n') ;
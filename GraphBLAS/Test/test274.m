@@ -0,0 +1,8 @@
+function test274
+%TEST274 test GxB_Matrix_serialize_stream and GxB_Matrix_deserialize_stream
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test27 ;
+fprintf ('test274 all tests passed.\n') ;
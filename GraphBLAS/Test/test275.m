@@ -0,0 +1,8 @@
+function test275
+%TEST275 test GxB_Matrix_deserialize_shallow
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test28 ;
+fprintf ('test275 all tests passed.\n') ;
@@ -0,0 +1,8 @@
+function test276
+%TEST276 test GB_wait (incremental append) and GxB_Matrix_ingest
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test29 ;
+fprintf ('test276 all tests passed.\n') ;
@@ -96,6 +96,10 @@ malloc_debugging = stat ;
 % tests with high rates (over 100/sec)
 %----------------------------------------
 
+logstat ('test276'    ,t, j4  , f1  ) ; % concurrent ingest
+logstat ('test275'    ,t, j4  , f1  ) ; % deserialize without copying
+logstat ('test274'    ,t, j4  , f1  ) ; % serialize to a stream
+logstat ('test273'    ,t, j4  , f1  ) ; % batched vxm and mxv
 logstat ('test272'    ,t, j0  , f1  ) ; % Context
 logstat ('test268'    ,t, j4  , f1  ) ; % C<M>=Z sparse masker
 jall = {4,3,2,1,4,2} ;